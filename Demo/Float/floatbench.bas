@@ -0,0 +1,73 @@
+'
+' floating point micro-benchmark
+' prints the average number of cycles each single precision
+' operation takes; build with
+'    fastspin -2 -O2 floatbench.bas
+' (or without -2 for P1) and compare -O2 against -Os and -O3
+'
+const N = 1000
+
+dim shared as integer base
+
+sub report(name as string, t as integer)
+  print name; ": "; (t - base) / N; " cycles"
+end sub
+
+dim as single x, y, k
+dim as integer i, t, hits
+
+' the cost of the loop itself
+x = 1.0
+t = getcnt()
+for i = 1 to N
+  hits = hits + i
+next i
+base = getcnt() - t
+
+print "float timing, "; N; " iterations each"
+
+x = 1.0
+y = 0.5
+t = getcnt()
+for i = 1 to N
+  x = x + y
+next i
+report("add ", getcnt() - t)
+
+t = getcnt()
+for i = 1 to N
+  x = x - y
+next i
+report("sub ", getcnt() - t)
+
+x = 1.0
+k = 1.0001
+t = getcnt()
+for i = 1 to N
+  x = x * k
+next i
+report("mul ", getcnt() - t)
+
+t = getcnt()
+for i = 1 to N
+  x = x / k
+next i
+report("div ", getcnt() - t)
+
+x = 2.0
+t = getcnt()
+for i = 1 to N
+  y = sqrt(x)
+  x = y
+next i
+report("sqrt", getcnt() - t)
+
+x = 1.0
+y = 2.0
+t = getcnt()
+for i = 1 to N
+  if x < y then hits = hits + 1
+next i
+report("cmp ", getcnt() - t)
+
+print "check: "; x; " "; y; " "; hits
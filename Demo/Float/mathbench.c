@@ -0,0 +1,251 @@
+/*
+ * transcendental function benchmark
+ * prints the average number of cycles each single precision math
+ * function takes, and its largest error over a set of arguments
+ * with known results; build with
+ *    fastspin -2 -O2 mathbench.c
+ * (or without -2 for P1)
+ *
+ * on P2 the exp, log, and pow results are compared against the
+ * generic versions that the CORDIC based ones fall back on
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <propeller.h>
+
+struct test {
+    uint32_t x, y;    /* arguments */
+    uint32_t r;       /* correctly rounded result */
+};
+
+#define NTESTS 16
+
+static const struct test sin_tests[] = {
+    { 0x3c23d70a, 0x00000000, 0x3c23d657 },  /* sin(0.00999999978) */
+    { 0xbca3d70a, 0x00000000, 0xbca3d43e },  /* sin(-0.0199999996) */
+    { 0x3dcccccd, 0x00000000, 0x3dcc7577 },  /* sin(0.100000001) */
+    { 0x3f000000, 0x00000000, 0x3ef57744 },  /* sin(0.5) */
+    { 0xbf400000, 0x00000000, 0xbf2e7fe1 },  /* sin(-0.75) */
+    { 0x3f800000, 0x00000000, 0x3f576aa4 },  /* sin(1) */
+    { 0x3fa00000, 0x00000000, 0x3f72f0a8 },  /* sin(1.25) */
+    { 0xbfc00000, 0x00000000, 0xbf7f5bd5 },  /* sin(-1.5) */
+    { 0x40000000, 0x00000000, 0x3f68c7b7 },  /* sin(2) */
+    { 0x40200000, 0x00000000, 0x3f193578 },  /* sin(2.5) */
+    { 0xc0400000, 0x00000000, 0xbe1081c3 },  /* sin(-3) */
+    { 0x40466666, 0x00000000, 0x3d2a5096 },  /* sin(3.0999999) */
+    { 0x40800000, 0x00000000, 0xbf41bdcf },  /* sin(4) */
+    { 0xc0b00000, 0x00000000, 0x3f349e4a },  /* sin(-5.5) */
+    { 0x41200000, 0x00000000, 0xbf0b44f8 },  /* sin(10) */
+    { 0x42c80000, 0x00000000, 0xbf01a12e },  /* sin(100) */
+};
+static const struct test cos_tests[] = {
+    { 0x3c23d70a, 0x00000000, 0x3f7ffcb9 },  /* cos(0.00999999978) */
+    { 0xbca3d70a, 0x00000000, 0x3f7ff2e5 },  /* cos(-0.0199999996) */
+    { 0x3dcccccd, 0x00000000, 0x3f7eb898 },  /* cos(0.100000001) */
+    { 0x3f000000, 0x00000000, 0x3f60a940 },  /* cos(0.5) */
+    { 0xbf400000, 0x00000000, 0x3f3b4ff6 },  /* cos(-0.75) */
+    { 0x3f800000, 0x00000000, 0x3f0a5140 },  /* cos(1) */
+    { 0x3fa00000, 0x00000000, 0x3ea171ef },  /* cos(1.25) */
+    { 0xbfc00000, 0x00000000, 0x3d90deaa },  /* cos(-1.5) */
+    { 0x40000000, 0x00000000, 0xbed51133 },  /* cos(2) */
+    { 0x40200000, 0x00000000, 0xbf4d17bf },  /* cos(2.5) */
+    { 0xc0400000, 0x00000000, 0xbf7d7026 },  /* cos(-3) */
+    { 0x40466666, 0x00000000, 0xbf7fc752 },  /* cos(3.0999999) */
+    { 0x40800000, 0x00000000, 0xbf275530 },  /* cos(4) */
+    { 0xc0b00000, 0x00000000, 0x3f356b62 },  /* cos(-5.5) */
+    { 0x41200000, 0x00000000, 0xbf56cd64 },  /* cos(10) */
+    { 0x42c80000, 0x00000000, 0x3f5cc0ee },  /* cos(100) */
+};
+static const struct test tan_tests[] = {
+    { 0x3c23d70a, 0x00000000, 0x3c23d870 },  /* tan(0.00999999978) */
+    { 0xbca3d70a, 0x00000000, 0xbca3dca2 },  /* tan(-0.0199999996) */
+    { 0x3dcccccd, 0x00000000, 0x3dcd7c44 },  /* tan(0.100000001) */
+    { 0x3f000000, 0x00000000, 0x3f0bda7b },  /* tan(0.5) */
+    { 0xbf400000, 0x00000000, 0xbf6e7d1b },  /* tan(-0.75) */
+    { 0x3f800000, 0x00000000, 0x3fc75923 },  /* tan(1) */
+    { 0x3fa00000, 0x00000000, 0x40409cca },  /* tan(1.25) */
+    { 0xbfc00000, 0x00000000, 0xc1619f6b },  /* tan(-1.5) */
+    { 0x40000000, 0x00000000, 0xc00bd7b1 },  /* tan(2) */
+    { 0x40200000, 0x00000000, 0xbf3f3cda },  /* tan(2.5) */
+    { 0xc0400000, 0x00000000, 0x3e11f7b9 },  /* tan(-3) */
+    { 0x40466666, 0x00000000, 0xbd2a7653 },  /* tan(3.0999999) */
+    { 0x40800000, 0x00000000, 0x3f94337d },  /* tan(4) */
+    { 0xc0b00000, 0x00000000, 0x3f7ede99 },  /* tan(-5.5) */
+    { 0x41200000, 0x00000000, 0x3f25fafa },  /* tan(10) */
+    { 0x42c80000, 0x00000000, 0xbf1653a7 },  /* tan(100) */
+};
+static const struct test atan2_tests[] = {
+    { 0x3f000000, 0x3f800000, 0x3eed6338 },  /* atan2(0.5, 1) */
+    { 0x3f800000, 0x3f800000, 0x3f490fdb },  /* atan2(1, 1) */
+    { 0x3f800000, 0x3f000000, 0x3f8db70d },  /* atan2(1, 0.5) */
+    { 0x40400000, 0xc0000000, 0x400a29c3 },  /* atan2(3, -2) */
+    { 0xbf800000, 0xbf800000, 0xc016cbe4 },  /* atan2(-1, -1) */
+    { 0xbe800000, 0xc0800000, 0xc045112f },  /* atan2(-0.25, -4) */
+    { 0xc0000000, 0x3dcccccd, 0xbfc2aad1 },  /* atan2(-2, 0.100000001) */
+    { 0x3c23d70a, 0x40000000, 0x3ba3d6b1 },  /* atan2(0.00999999978, 2) */
+    { 0x3a83126f, 0xbf800000, 0x4048ff78 },  /* atan2(0.00100000005, -1) */
+    { 0x40a00000, 0x40e00000, 0x3f1ec8ac },  /* atan2(5, 7) */
+    { 0xc0e00000, 0x40a00000, 0xbf73570a },  /* atan2(-7, 5) */
+    { 0x3a83126f, 0x3a83126f, 0x3f490fdb },  /* atan2(0.00100000005, 0.00100000005) */
+    { 0x42c80000, 0x3f800000, 0x3fc7c82f },  /* atan2(100, 1) */
+    { 0xbf000000, 0x3e800000, 0xbf8db70d },  /* atan2(-0.5, 0.25) */
+    { 0x40000000, 0xc0000000, 0x4016cbe4 },  /* atan2(2, -2) */
+    { 0x00000000, 0xbf800000, 0x40490fdb },  /* atan2(0, -1) */
+};
+static const struct test exp_tests[] = {
+    { 0xc1a00000, 0x00000000, 0x310da433 },  /* exp(-20) */
+    { 0xc1200000, 0x00000000, 0x383e6bce },  /* exp(-10) */
+    { 0xc0b00000, 0x00000000, 0x3b85ea53 },  /* exp(-5.5) */
+    { 0xbf800000, 0x00000000, 0x3ebc5ab2 },  /* exp(-1) */
+    { 0xbf000000, 0x00000000, 0x3f1b4598 },  /* exp(-0.5) */
+    { 0xbdcccccd, 0x00000000, 0x3f67a36d },  /* exp(-0.100000001) */
+    { 0xba83126f, 0x00000000, 0x3f7fbe7f },  /* exp(-0.00100000005) */
+    { 0x3a83126f, 0x00000000, 0x3f8020c9 },  /* exp(0.00100000005) */
+    { 0x3dcccccd, 0x00000000, 0x3f8d763e },  /* exp(0.100000001) */
+    { 0x3f000000, 0x00000000, 0x3fd3094c },  /* exp(0.5) */
+    { 0x3f800000, 0x00000000, 0x402df854 },  /* exp(1) */
+    { 0x40200000, 0x00000000, 0x4142eb7f },  /* exp(2.5) */
+    { 0x40a00000, 0x00000000, 0x431469c5 },  /* exp(5) */
+    { 0x41200000, 0x00000000, 0x46ac14ee },  /* exp(10) */
+    { 0x41a00000, 0x00000000, 0x4de75844 },  /* exp(20) */
+    { 0x42a00000, 0x00000000, 0x792abbce },  /* exp(80) */
+};
+static const struct test log_tests[] = {
+    { 0x3a83126f, 0x00000000, 0xc0dd0c55 },  /* log(0.00100000005) */
+    { 0x3c23d70a, 0x00000000, 0xc0935d8e },  /* log(0.00999999978) */
+    { 0x3dcccccd, 0x00000000, 0xc0135d8e },  /* log(0.100000001) */
+    { 0x3f000000, 0x00000000, 0xbf317218 },  /* log(0.5) */
+    { 0x3f333333, 0x00000000, 0xbeb69e1a },  /* log(0.699999988) */
+    { 0x3f733333, 0x00000000, 0xbd5218ee },  /* log(0.949999988) */
+    { 0x3f8147ae, 0x00000000, 0x3c2306ac },  /* log(1.00999999) */
+    { 0x3f8ccccd, 0x00000000, 0x3dc331ff },  /* log(1.10000002) */
+    { 0x3fc00000, 0x00000000, 0x3ecf991f },  /* log(1.5) */
+    { 0x40000000, 0x00000000, 0x3f317218 },  /* log(2) */
+    { 0x40400000, 0x00000000, 0x3f8c9f54 },  /* log(3) */
+    { 0x41200000, 0x00000000, 0x40135d8e },  /* log(10) */
+    { 0x42c80000, 0x00000000, 0x40935d8e },  /* log(100) */
+    { 0x447a0000, 0x00000000, 0x40dd0c55 },  /* log(1000) */
+    { 0x4640e400, 0x00000000, 0x4116bc71 },  /* log(12345) */
+    { 0x49742400, 0x00000000, 0x415d0c55 },  /* log(1000000) */
+};
+static const struct test pow_tests[] = {
+    { 0x40000000, 0x3f000000, 0x3fb504f3 },  /* pow(2, 0.5) */
+    { 0x40000000, 0xbf000000, 0x3f3504f3 },  /* pow(2, -0.5) */
+    { 0x41200000, 0x40200000, 0x439e1d27 },  /* pow(10, 2.5) */
+    { 0x3f000000, 0x40400000, 0x3e000000 },  /* pow(0.5, 3) */
+    { 0x40400000, 0xc0100000, 0x3dace7a3 },  /* pow(3, -2.25) */
+    { 0x3fc00000, 0x40e00000, 0x4188b000 },  /* pow(1.5, 7) */
+    { 0x3f666666, 0xc0d00000, 0x3ffde211 },  /* pow(0.899999976, -6.5) */
+    { 0x40e00000, 0x3fc00000, 0x4194297e },  /* pow(7, 1.5) */
+    { 0x42c80000, 0x3e800000, 0x404a62c2 },  /* pow(100, 0.25) */
+    { 0x3dcccccd, 0xc0000000, 0x42c80000 },  /* pow(0.100000001, -2) */
+    { 0x40000000, 0x41200000, 0x44800000 },  /* pow(2, 10) */
+    { 0x40000000, 0xc1200000, 0x3a800000 },  /* pow(2, -10) */
+    { 0x3f8147ae, 0x42700000, 0x3fe8897c },  /* pow(1.00999999, 60) */
+    { 0x40400000, 0x41a00000, 0x4f4fd41c },  /* pow(3, 20) */
+    { 0x3e800000, 0xc1a00000, 0x53800000 },  /* pow(0.25, -20) */
+    { 0x40a00000, 0x3c23d70a, 0x3f8213a6 },  /* pow(5, 0.00999999978) */
+};
+
+#ifdef __P2__
+float _expf_generic(float x);
+float _logf_generic(float x);
+float _powf_generic(float x, float y);
+#endif
+
+typedef union {
+    float f;
+    uint32_t i;
+} FI;
+
+static float results[NTESTS];
+static unsigned base;
+
+static float asfloat(uint32_t i)
+{
+    FI u;
+    u.i = i;
+    return u.f;
+}
+
+/* distance between two floats in units in the last place */
+static unsigned ulps(float a, float b)
+{
+    FI ua, ub;
+    int32_t ia, ib, d;
+
+    ua.f = a;
+    ub.f = b;
+    ia = (ua.i >> 31) ? -(int32_t)(ua.i & 0x7fffffff) : (int32_t)ua.i;
+    ib = (ub.i >> 31) ? -(int32_t)(ub.i & 0x7fffffff) : (int32_t)ub.i;
+    d = ia - ib;
+    return d < 0 ? -d : d;
+}
+
+/*
+ * print the timing and the largest error; sin and cos are accurate to
+ * a fixed number of bits rather than relative to the result, so their
+ * error is printed in units of 2^-24 instead
+ */
+static void report(const char *name, unsigned t, const struct test *tab, int absolute)
+{
+    int i;
+    unsigned u, maxu = 0;
+    float e, maxe = 0.0f;
+    float ref;
+
+    for (i = 0; i < NTESTS; i++) {
+        ref = asfloat(tab[i].r);
+        if (absolute) {
+            e = fabsf(results[i] - ref) * 16777216.0f;
+            if (e > maxe) maxe = e;
+        } else {
+            u = ulps(results[i], ref);
+            if (u > maxu) maxu = u;
+        }
+    }
+    t = (t > base) ? t - base : 0;
+    if (absolute) {
+        printf("%-8s %6u cycles  max error %f * 2^-24\n", name, t / NTESTS, maxe);
+    } else {
+        printf("%-8s %6u cycles  max error %u ulp\n", name, t / NTESTS, maxu);
+    }
+}
+
+#define BENCH(name, call, tab, absolute)        \
+    t = getcnt();                               \
+    for (i = 0; i < NTESTS; i++) {              \
+        x = asfloat(tab[i].x);                  \
+        y = asfloat(tab[i].y);                  \
+        results[i] = call;                      \
+    }                                           \
+    t = getcnt() - t;                           \
+    report(name, t, tab, absolute)
+
+int main()
+{
+    int i;
+    unsigned t;
+    float x, y;
+
+    // the cost of the loop itself
+    base = 0;
+    BENCH("loop", x, sin_tests, 1);
+    base = t;
+
+    BENCH("sinf", sinf(x), sin_tests, 1);
+    BENCH("cosf", cosf(x), cos_tests, 1);
+    BENCH("tanf", tanf(x), tan_tests, 0);
+    BENCH("atan2f", atan2f(x, y), atan2_tests, 0);
+    BENCH("expf", expf(x), exp_tests, 0);
+    BENCH("logf", logf(x), log_tests, 0);
+    BENCH("powf", powf(x, y), pow_tests, 0);
+#ifdef __P2__
+    printf("generic versions:\n");
+    BENCH("expf", _expf_generic(x), exp_tests, 0);
+    BENCH("logf", _logf_generic(x), log_tests, 0);
+    BENCH("powf", _powf_generic(x, y), pow_tests, 0);
+#endif
+    return 0;
+}
@@ -0,0 +1,194 @@
+//
+// heap allocator benchmark
+// keeps a table of live blocks, and repeatedly frees a random one and
+// allocates a new block in its place, first with only small sizes and
+// then with a mix of small and large ones; prints the average cycles
+// for each free and allocate pair
+// then it grows a buffer with realloc, and prints the average cycles for
+// each realloc and how many of them had to move the buffer
+// then it does the same with garbage collected blocks which are never
+// freed, and prints the longest time any one allocation took (including
+// garbage collection), with and without incremental collection, and
+// with the heap left out of the marking
+//
+// run it under a simulator with allocbench.sh, or on a board
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <propeller.h>
+
+enum { heapsize = 12000 };
+
+#define NSLOTS 48
+#define ROUNDS 1000
+
+static char *slot[NSLOTS];
+static int slotsize[NSLOTS];
+static unsigned seed = 1;
+static int errors;
+
+static unsigned
+nextrand(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 16;
+}
+
+static void
+check(int i)
+{
+    int j;
+    for (j = 0; j < slotsize[i]; j++) {
+        if (slot[i][j] != (char)(i + j)) {
+            errors++;
+            return;
+        }
+    }
+}
+
+static unsigned
+run(int maxsmall, int largesize, int largeodds)
+{
+    unsigned start, elapsed = 0;
+    int i, r, n, size, fails = 0;
+
+    for (r = 0; r < ROUNDS; r++) {
+        i = nextrand() % NSLOTS;
+        if (largeodds && (nextrand() % largeodds) == 0) {
+            size = largesize + nextrand() % largesize;
+        } else {
+            size = 1 + nextrand() % maxsmall;
+        }
+        if (slot[i]) {
+            check(i);
+        }
+        start = getcnt();
+        free(slot[i]);
+        slot[i] = malloc(size);
+        elapsed += getcnt() - start;
+        if (!slot[i]) {
+            fails++;
+            size = 0;
+        }
+        slotsize[i] = size;
+        for (n = 0; n < size; n++) {
+            slot[i][n] = (char)(i + n);
+        }
+    }
+    for (i = 0; i < NSLOTS; i++) {
+        if (slot[i]) {
+            check(i);
+            free(slot[i]);
+            slot[i] = 0;
+        }
+    }
+    if (fails) {
+        printf("  %d allocations failed\n", fails);
+    }
+    return elapsed / ROUNDS;
+}
+
+#define GROWSTEP 24
+#define GROWTO 2400
+
+static unsigned
+rungrow(int *moved)
+{
+    unsigned start, elapsed = 0;
+    char *buf = 0, *newbuf;
+    int i, size, calls = 0;
+
+    *moved = 0;
+    for (size = GROWSTEP; size <= GROWTO; size += GROWSTEP) {
+        start = getcnt();
+        newbuf = realloc(buf, size);
+        elapsed += getcnt() - start;
+        calls++;
+        if (!newbuf) {
+            errors++;
+            break;
+        }
+        if (buf && newbuf != buf) {
+            (*moved)++;
+        }
+        buf = newbuf;
+        for (i = size - GROWSTEP; i < size; i++) {
+            buf[i] = (char)i;
+        }
+        // a small block now and then, which may be in the way
+        if ((size % (8*GROWSTEP)) == 0) {
+            slot[size % NSLOTS] = malloc(8);
+        }
+    }
+    for (i = 0; i < size - GROWSTEP; i++) {
+        if (buf[i] != (char)i) {
+            errors++;
+            break;
+        }
+    }
+    buf = realloc(buf, 100);
+    for (i = 0; i < 100; i++) {
+        if (buf[i] != (char)i) {
+            errors++;
+            break;
+        }
+    }
+    free(buf);
+    for (i = 0; i < NSLOTS; i++) {
+        free(slot[i]);
+        slot[i] = 0;
+    }
+    return elapsed / calls;
+}
+
+static unsigned
+runmanaged(int budget)
+{
+    unsigned start, elapsed, worst = 0;
+    int i, r;
+
+    _gc_incremental(budget);
+    for (r = 0; r < ROUNDS; r++) {
+        i = nextrand() % NSLOTS;
+        start = getcnt();
+        slot[i] = _gc_alloc_managed(1 + nextrand() % 100);
+        elapsed = getcnt() - start;
+        if (elapsed > worst) {
+            worst = elapsed;
+        }
+        if (!slot[i]) {
+            errors++;
+        }
+    }
+    for (i = 0; i < NSLOTS; i++) {
+        slot[i] = 0;
+    }
+    _gc_collect();
+    return worst;
+}
+
+int
+main()
+{
+    unsigned t;
+    int n;
+
+    t = run(100, 0, 0);
+    printf("small:  %u cycles per free and malloc\n", t);
+    t = run(100, 400, 8);
+    printf("mixed:  %u cycles per free and malloc\n", t);
+    t = rungrow(&n);
+    printf("grow:   %u cycles per realloc, %d of %d moved\n", t, n, GROWTO/GROWSTEP - 1);
+    t = runmanaged(0);
+    printf("pause:  %u cycles at most (collect when full)\n", t);
+    t = runmanaged(4);
+    printf("pause:  %u cycles at most (sweep 4 blocks per allocation)\n", t);
+    t = runmanaged(16);
+    printf("pause:  %u cycles at most (sweep 16 blocks per allocation)\n", t);
+    _gc_scanheap(0);
+    t = runmanaged(16);
+    printf("pause:  %u cycles at most (sweep 16 blocks, heap not scanned)\n", t);
+    printf("errors: %d\n", errors);
+    return 0;
+}
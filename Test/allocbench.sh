@@ -0,0 +1,30 @@
+#!/bin/sh
+#
+# run the heap allocator benchmark (allocbench.c) under a simulator
+# and print the average cycles for each free and malloc pair, and the
+# longest garbage collection pauses
+#
+#   allocbench.sh [fastspin [simulator]]
+#
+# the simulator must take a P1 binary and copy the serial output to
+# stdout, like "spinsim -b"
+#
+
+if [ "$1" != "" ]; then
+  FASTSPIN=$1
+else
+  FASTSPIN=../build/fastspin
+fi
+if [ "$2" != "" ]; then
+  SIM=$2
+else
+  SIM="spinsim -b"
+fi
+
+if ! $FASTSPIN -q -O1 -I../include -o allocbench.binary allocbench.c
+then
+  echo "allocbench.c: compile failed"
+  exit 1
+fi
+$SIM allocbench.binary
+rm -f allocbench.binary allocbench.pasm
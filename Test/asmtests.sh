@@ -11,6 +11,18 @@ CC=propeller-elf-gcc
 ok="ok"
 endmsg=$ok
 
+# a test may ask for other optimizations with "--optimize N" in its
+# first line; otherwise the default given below is used
+optflags() {
+  sed -n '1s/.*--optimize \(0x[0-9a-fA-F]*\).*/\1/p' $1
+}
+# "--binary" in the first line compiles a whole program, as fastspin does,
+# "--list" keeps the source lines as comments, and "--code=" and "--lmm="
+# are passed on as they are
+extraflags() {
+  sed -n 1p $1 | grep -o -e '--binary' -e '--list' -e '--code=[a-z]*' -e '--lmm=[a-z0-9=,]*'
+}
+
 # ASM mode compilation tests
 for i in stest*.spin
 do
@@ -18,10 +30,11 @@ do
   # NOTE: optimize 250 is all optimizations except
   #   remove_unused_funcs (0x01)
   #   remove_hub_bss (0x04)
-  $PROG --asm --optimize 250 --noheader $i
+  opt=`optflags $i`
+  $PROG --asm `extraflags $i` --optimize ${opt:-250} --noheader $i
   if  diff -ub Expect/$j.pasm $j.pasm
   then
-      rm -f $j.pasm
+      rm -f $j.pasm $j.binary
       echo $j passed
   else
       echo $j failed
@@ -35,7 +48,26 @@ do
   # NOTE: optimize 250 is all optimizations except
   #   remove_unused_funcs (0x01)
   #   remove_hub_bss (0x04)
-  $PROG --p2 --asm --optimize 250 --noheader $i
+  opt=`optflags $i`
+  $PROG --p2 --asm --optimize ${opt:-250} --noheader $i
+  if  diff -ub Expect/$j.p2asm $j.p2asm
+  then
+      rm -f $j.p2asm
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+for i in shtest*.spin2
+do
+  j=`basename $i .spin2`
+  # P2 hub code tests (the "s" keeps p2bin.sh from picking these up)
+  # NOTE: optimize 0x1fa is optimize 250 plus
+  #   auto_place (0x100)
+  opt=`optflags $i`
+  $PROG --p2 --asm --code=hub --optimize ${opt:-0x1fa} --noheader $i
   if  diff -ub Expect/$j.p2asm $j.p2asm
   then
       rm -f $j.p2asm
@@ -52,7 +84,8 @@ do
   # NOTE: optimize 250 is all optimizations except
   #   remove_unused_funcs (0x01)
   #   remove_hub_bss (0x04)
-  $PROG --asm --optimize 250 --noheader $i
+  opt=`optflags $i`
+  $PROG --asm --optimize ${opt:-250} --noheader $i
   if  diff -ub Expect/$j.pasm $j.pasm
   then
       rm -f $j.pasm
@@ -69,7 +102,8 @@ do
   # NOTE: optimize 250 is all optimizations except
   #   remove_unused_funcs (0x01)
   #   remove_hub_bss (0x04)
-  $PROG --asm --optimize 250 --noheader $i
+  opt=`optflags $i`
+  $PROG --asm --optimize ${opt:-250} --noheader $i
   if  diff -ub Expect/$j.pasm $j.pasm
   then
       rm -f $j.pasm
@@ -86,7 +120,8 @@ do
   # NOTE: optimize 250 is all optimizations except
   #   remove_unused_funcs (0x01)
   #   remove_hub_bss (0x04)
-  $PROG --asm --optimize 250 --noheader $i
+  opt=`optflags $i`
+  $PROG --asm --optimize ${opt:-250} --noheader $i
   if  diff -ub Expect/$j.pasm $j.pasm
   then
       rm -f $j.pasm
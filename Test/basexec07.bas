@@ -0,0 +1,66 @@
+''
+'' tests of building strings a piece at a time
+''
+dim shared as string saved
+
+function build(n as integer) as string
+  dim s as string
+  dim i as integer
+  s = ""
+  for i = 0 to n-1
+    s = s + chr$(65 + (i mod 26))
+  next i
+  return s
+end function
+
+sub keep(x as string)
+  saved = x
+end sub
+
+sub addbyref(byref x as string)
+  x = x + "!"
+end sub
+
+function addparam(s as string, n as integer) as string
+  dim i as integer
+  for i = 1 to n
+    s = s + mid$("0123456789", i, 1) + "."
+  next i
+  return s
+end function
+
+sub aliases()
+  dim s, t, u as string
+  dim i as integer
+  s = "ab"
+  s = s + "c"
+  t = s
+  s = s + "d"
+  keep(s)
+  s = s + "e" + "f"
+  u = s
+  while len(s) < 9
+    s = s + "x"
+  end while
+  if s = "abcdefxxx" then print "compare ok"
+  print s; "|"; t; "|"; saved; "|"; u
+  s = left$(s, 2)
+  s = s + chr$(0) + "z"
+  print s; " "; len(s)
+  addbyref(s)
+  s = s + "?"
+  print s
+end sub
+
+dim s as string
+s = build(60)
+print len(s); " "; s
+s = build(200)
+print len(s); " "; left$(s, 5); " "; right$(s, 5)
+print addparam("digits:", 5)
+aliases()
+
+''
+'' send the magic propload status code
+''
+print \255; \0; \0;
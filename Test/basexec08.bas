@@ -0,0 +1,41 @@
+''
+'' tests of temporary strings and method pointers kept on the stack
+''
+class counter
+  dim n as integer
+  function inc() as integer
+    n = n + 1
+    return n
+  end function
+end class
+
+dim c as counter
+dim f as function() as integer
+dim as string s, t, u
+dim i as integer
+
+function hex$(x as integer) as string
+  return "hex"
+end function
+
+for i = 1 to 3
+  print "n=" + str$(i) + " b=" + bin$(i, 4) + " o=" + oct$(i + 8) + " " + chr$(64 + i)
+next i
+'' results which are kept must still go on the heap
+s = "s" + str$(1.5)
+t = decuns$(12345) + "t"
+u = chr$(33)
+print s; " "; t; " "; u; " "; hex$(255)
+'' results too big for the stack buffer
+s = "0123456789012345678901234567890123456789" + "0123456789012345678901234567890123456789"
+print len(s); " "; len("0123456789012345678901234567890123456789" + "01234567890123456789012345678901234567890")
+print len(bin$(-1)); " "; bin$(5)
+if oct$(8, 3) = "010" then print "compare ok"
+f = @c.inc
+print f(); " "; f()
+if f = @c.inc then print "same method"
+
+''
+'' send the magic propload status code
+''
+print \255; \0; \0;
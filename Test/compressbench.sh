@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# report how well compressed mode (-z) does on the execution tests:
+# the binary size with and without -z, how many bytes the compressed
+# instructions take compared to 4 per long, and the estimated clocks
+# to decode one instruction (weighted by how often it is expected to run)
+#
+
+if [ "$1" != "" ]; then
+  FASTSPIN=$1
+else
+  FASTSPIN=../build/fastspin
+fi
+
+PROG="$FASTSPIN -q -O2 -I../include"
+totlmm=0
+totz=0
+
+printf "%-16s %8s %8s %6s %8s %8s\n" file lmm "-z" ratio instrs clocks
+for i in exec*.spin basexec*.bas cexec*.c
+do
+  j=`echo $i | sed 's/\.[a-z]*$//'`
+  if ! $PROG -o $j.binary $i >/dev/null 2>&1
+  then
+      echo "$i: compile failed"
+      continue
+  fi
+  lmm=`wc -c < $j.binary`
+  stats=`$PROG -zv -o $j.binary $i 2>/dev/null | grep "instructions:"`
+  if [ "$stats" = "" ]
+  then
+      echo "$i: compile with -z failed"
+      rm -f $j.binary $j.pasm
+      continue
+  fi
+  z=`wc -c < $j.binary`
+  instrs=`echo "$stats" | sed 's/.*(\([0-9]*%\)).*/\1/'`
+  clocks=`echo "$stats" | sed 's/.*about \([0-9]*\) clocks.*/\1/'`
+  printf "%-16s %8d %8d %5d%% %8s %8s\n" $i $lmm $z $((100 * z / lmm)) $instrs $clocks
+  totlmm=$((totlmm + lmm))
+  totz=$((totz + z))
+  rm -f $j.binary $j.pasm
+done
+printf "%-16s %8d %8d %5d%%\n" total $totlmm $totz $((100 * totz / totlmm))
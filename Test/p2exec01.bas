@@ -0,0 +1,16 @@
+''
+'' garbage collection while a managed string is live
+''
+dim as string s, t, u
+dim i as integer
+
+'' an odd length literal, so that the data after it is not long aligned
+u = "hellox"
+s = u + str$(12345)
+_gc_collect()
+'' if s was freed above these allocations will overwrite it
+for i = 1 to 40
+  t = "garbage" + str$(i)
+next i
+print s
+print t
@@ -0,0 +1,40 @@
+#!/bin/sh
+
+if [ "$1" != "" ]; then
+    FASTSPIN="$1"
+else
+    FASTSPIN="../build/fastspin -2 -q"
+fi
+
+PROG_ASM="$FASTSPIN -I../Lib"
+LOADP2="loadp2 -b230400 -t -q"
+
+ok="ok"
+endmsg=$ok
+
+#
+# run tests on a P2 board
+#
+
+echo "running tests on P2..."
+
+for i in p2exec*.bas
+do
+  j=`basename $i .bas`
+
+  if $PROG_ASM -o $j.binary $i; then
+    $LOADP2 $j.binary > $j.out
+  fi
+  # strip the loader's own messages
+  grep -v "^\( Loading\|Loaded\|\[ Entering terminal\)" $j.out | tr -d '\r' > $j.txt
+  if diff -ub Expect/$j.txt $j.txt
+  then
+    echo $j passed for ASM
+    rm -f $j.out $j.txt $j.binary $j.p2asm
+  else
+    echo $j failed
+    endmsg="TEST FAILURES"
+  fi
+done
+
+echo $endmsg
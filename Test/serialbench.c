@@ -0,0 +1,40 @@
+//
+// console output benchmark
+// prints two bursts of text, one with printf and one with write, each
+// small enough to fit in the buffer used by --serial=buffered, and then
+// how many cycles the program spent on each burst; with the helper cog
+// the program does not have to wait for the serial port
+//
+// run it under a simulator with serialbench.sh, or on a board
+//
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <propeller.h>
+
+static const char line[] = "the quick brown fox jumps over the lazy dog\n";
+
+int
+main()
+{
+    unsigned start, tprintf, twrite;
+    int i;
+
+    start = getcnt();
+    for (i = 0; i < 4; i++) {
+        printf("%d: %s", i, line);
+    }
+    tprintf = getcnt() - start;
+    _txflush();
+
+    start = getcnt();
+    for (i = 0; i < 4; i++) {
+        write(1, line, strlen(line));
+    }
+    twrite = getcnt() - start;
+    _txflush();
+
+    printf("printf: %u cycles\n", tprintf);
+    printf("write:  %u cycles\n", twrite);
+    return 0;
+}
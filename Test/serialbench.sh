@@ -0,0 +1,34 @@
+#!/bin/sh
+#
+# run the console output benchmark (serialbench.c) under a simulator,
+# with the default serial routines and with --serial=buffered, and
+# print the cycles each burst of output took
+#
+#   serialbench.sh [fastspin [simulator]]
+#
+# the simulator must take a P1 binary and copy the serial output to
+# stdout, like "spinsim -b"
+#
+
+if [ "$1" != "" ]; then
+  FASTSPIN=$1
+else
+  FASTSPIN=../build/fastspin
+fi
+if [ "$2" != "" ]; then
+  SIM=$2
+else
+  SIM="spinsim -b"
+fi
+
+for mode in direct buffered
+do
+  if ! $FASTSPIN -q -O1 --serial=$mode -I../include -o serialbench.binary serialbench.c
+  then
+    echo "serialbench.c: compile failed"
+    exit 1
+  fi
+  echo "--serial=$mode"
+  $SIM serialbench.binary | grep cycles
+done
+rm -f serialbench.binary serialbench.pasm
@@ -0,0 +1,11 @@
+// --optimize 0x8fa: string pooling (250 plus merge strings)
+// C string literals may not be changed, so the second "hello" uses
+// the first one's bytes and "llo" points into them
+const char *msgs[3];
+
+void main()
+{
+    msgs[0] = "hello";
+    msgs[1] = "hello";
+    msgs[2] = "llo";
+}
@@ -734,6 +734,30 @@ PrintCompressLocalCall(struct flexbuf *fb, const char *labelStr)
     flexbuf_printf(fb, "\tbyte\t$E0 + (%s>>8)\n\tbyte\t%s & $FF\n", labelStr, labelStr);
 }
 
+// in compressed code, print the prefix marking a full instruction
+static void
+PrintCompressCond(struct flexbuf *fb, int cond)
+{
+    if (cond == COND_TRUE) {
+        flexbuf_addstr(fb, "\t<");
+    } else {
+        flexbuf_addstr(fb, "\tbyte $D0\n");
+        PrintCond(fb, cond);
+    }
+}
+
+// print a call or jump through LMM_NEW_PC in compressed code
+static void
+PrintCompressIndirect(struct flexbuf *fb, int cond, Operand *dst, const char *labelStr)
+{
+    PrintCompressCond(fb, cond);
+    flexbuf_addstr(fb, "mov\tLMM_NEW_PC, ");
+    PrintOperand(fb, dst);
+    flexbuf_addstr(fb, "\n");
+    PrintCompressCond(fb, cond);
+    flexbuf_printf(fb, "jmpret\tLMM_ra, #%s\n", labelStr);
+}
+
 // print a conditional jump to "dst"
 static void
 PrintCompressCondJump(struct flexbuf *fb, int cond, Operand *dst)
@@ -928,7 +952,10 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 }
                 return;
             } else if (IsLocalOrArg(ir->dst)) {
-                if (lmmMode) {
+                if (lmmMode && gl_lmm_kind == LMM_KIND_COMPRESS) {
+                    PrintCompressIndirect(fb, ir->cond, ir->dst, "LMM_CALL_PTR");
+                    return;
+                } else if (lmmMode) {
                     PrintCond(fb, ir->cond);
                     flexbuf_addstr(fb, "mov\tLMM_NEW_PC, ");
                     PrintOperand(fb, ir->dst);
@@ -1008,7 +1035,10 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
                 flexbuf_addstr(fb, ")\n");
                 return;
             } else if (IsLocalOrArg(ir->dst) && lmmMode) {
-                if (lmmMode) {
+                if (gl_lmm_kind == LMM_KIND_COMPRESS) {
+                    PrintCompressIndirect(fb, ir->cond, ir->dst, "LMM_JUMP_PTR");
+                    return;
+                } else if (lmmMode) {
                     PrintCond(fb, ir->cond);
                     flexbuf_addstr(fb, "mov\tLMM_NEW_PC, ");
                     PrintOperand(fb, ir->dst);
@@ -1087,12 +1117,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
         int ccset;
 
         if (lmmMode && gl_lmm_kind == LMM_KIND_COMPRESS) {
-            if (ir->cond == COND_TRUE) {
-                flexbuf_addstr(fb, "\t<");
-            } else {
-                flexbuf_addstr(fb, "\tbyte $D0\n");
-                PrintCond(fb, ir->cond);
-            }
+            PrintCompressCond(fb, ir->cond);
         } else {
             PrintCond(fb, ir->cond);
         }
@@ -1243,6 +1268,7 @@ DoAssembleIR(struct flexbuf *fb, IR *ir, Module *P)
         flexbuf_printf(fb, "\torg\t");
         PrintOperandAsValue(fb, ir->dst);
         flexbuf_printf(fb, "\n");
+        lmmMode = 0;
         break;
     case OPC_HUBMODE:
         if (gl_p2) {
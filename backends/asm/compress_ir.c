@@ -29,6 +29,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include "spinc.h"
 #include "outasm.h"
 
@@ -43,9 +44,87 @@ Flexbuf instrcount;
 
 #define MAX_COMPRESS 32
 
-IR *cinstr_table[MAX_COMPRESS];
-Operand *cdst_table[MAX_COMPRESS];
-Operand *csrc_table[MAX_COMPRESS];
+// compressed forms only have 4 bits for the instruction; a function
+// may take its instructions from either half of the table
+#define INSTR_SET_SIZE 16
+
+// single byte codes $C1-$CD run a pair of instructions from
+// COMPRESS_PAIRS, and $CE/$CF select the half of the table
+#define MAX_PAIRS   13
+#define PAIR_BYTE   0xC0
+#define SELECT_SET0 0xCE
+#define SELECT_SET1 0xCF
+
+typedef struct CompressDict {
+    IR *instr[MAX_COMPRESS];
+    Operand *dst[MAX_COMPRESS];
+    Operand *src[MAX_COMPRESS];
+} CompressDict;
+
+// what we know about each IR in the hub code
+typedef struct CompressInfo {
+    IR *ir;
+    int weight;    // estimate of how often it runs
+    int region;    // which function it is in
+    int pair;      // 1 + index in the pair table, for the first of a pair
+    int paired;    // set for both instructions of a pair
+} CompressInfo;
+
+// the functions in the hub code; region 0 is the code before the
+// first function
+typedef struct CompressRegion {
+    Function *func;
+    int set;       // which half of the table its instructions use
+    int size[2];   // its size using each half
+} CompressRegion;
+
+typedef struct PairFreq {
+    IR *first;
+    IR *second;
+    int saved;     // bytes saved, less the space in COMPRESS_PAIRS
+    long long weight; // clocks saved, weighted by how often they run
+} PairFreq;
+
+// approximate clocks to decode each form, assuming hub reads average
+// 16 clocks; these are counted from the paths in lmm_compress.spin
+#define CLOCKS_WORD   176
+#define CLOCKS_TUPLE  164
+#define CLOCKS_FULL   212
+#define CLOCKS_PAIR   124   // for both instructions
+#define CLOCKS_SELECT  96
+
+// loops are assumed to run 8 times per level of nesting
+#define MAX_LOOP_DEPTH 3
+
+// bytes taken by the code which runs pairs and selects table halves
+#define PAIR_CODE_SIZE (17*4)
+
+// runs the $C1-$CF single byte codes
+static const char *compress_pair_code =
+    "handle_pair\n"
+    "\tcmp\topcode, #$E wz, wc\n"
+    "  if_nc\tjmp\t#select_table\n"
+    "\tadd\topcode, opcode\n"
+    "\tadd\topcode, #COMPRESS_PAIRS-2\n"
+    "\tmovs\tp_fetch1, opcode\n"
+    "\tadd\topcode, #1\n"
+    "\tmovs\tp_fetch2, opcode\n"
+    "\tshr\tsave_cz, #1 wz, wc\n"
+    "p_fetch1\n"
+    "\tmov\tpair1, 0-0\n"
+    "p_fetch2\n"
+    "\tmov\tpair2, 0-0\n"
+    "pair1\n"
+    "\tnop\n"
+    "pair2\n"
+    "\tnop\n"
+    "\tjmp\t#LMM_LOOP\n"
+    "select_table\n"
+    "  if_z\tmov\tctable, #COMPRESS_TABLE\n"
+    "  if_nz\tmov\tctable, #COMPRESS_TABLE+16\n"
+    "\tshr\tsave_cz, #1 wz, wc\n"
+    "\tjmp\t#LMM_LOOP\n"
+    ;
 
 // check to see if an operand is a simple 9 bit op
 static int
@@ -65,6 +144,30 @@ IsSimple9BitOperand(Operand *op)
     }
 }
 
+// check for instructions which may go in the dictionary
+static int
+IsCompressible(IR *ir)
+{
+    if (ir->opc >= OPC_GENERIC) {
+        // not an opcode we're comfortable with
+        return 0;
+    }
+    return ir->instr && ir->instr->ops == TWO_OPERANDS;
+}
+
+// check for instructions which may be run from COMPRESS_PAIRS
+static int
+IsPairable(IR *ir)
+{
+    if (!IsCompressible(ir)) {
+        return 0;
+    }
+    if (ir->opc == OPC_DJNZ || ir->opc == OPC_JMPRET) {
+        return 0;
+    }
+    return IsSimple9BitOperand(ir->dst) && IsSimple9BitOperand(ir->src);
+}
+
 // sorter function for PtrFreq
 int freqsort_fn(const void *aptr, const void *bptr)
 {
@@ -103,6 +206,12 @@ static int MatchIR(void *aptr, void *bptr)
     return a->srceffect == b->srceffect && a->dsteffect == b->dsteffect;
 }
 
+// check for the same instruction with the same operands
+static int MatchWholeIR(IR *a, IR *b)
+{
+    return MatchIR(a, b) && MatchOperand(a->dst, b->dst) && MatchOperand(a->src, b->src);
+}
+
 // record an operand in a frequency tables
 #define RecordOperand(fb, oper) RecordItem(fb, oper, MatchOperand)
 #define RecordInstr(fb, instr) RecordItem(fb, instr, MatchIR)
@@ -209,37 +318,63 @@ static int FindPtr(void **table, void *ptr, int (*matchptr)(void *, void *))
     return i;
 }
 
-// walk through and record the most popular instructions/operands in the
-// list "irl" into the list "kernel"
-int gl_printstats = 0;
+// find an instruction in half "set" of the table; returns
+// INSTR_SET_SIZE if it is not there
+static int FindInstr(CompressDict *dict, IR *ir, int set)
+{
+    int i;
+    for (i = 0; i < INSTR_SET_SIZE; i++) {
+        if (MatchIR(dict->instr[set*INSTR_SET_SIZE + i], ir)) {
+            break;
+        }
+    }
+    return i;
+}
 
-void IRCompress(IRList *irl, IRList *kernel)
+//
+// count the instructions for a dictionary in the regions using half
+// "set" of the table (or in all of them if "set" is -1), and put the
+// most popular ones in "table"
+//
+static void
+CountInstrs(IR **table, CompressInfo *info, int n, CompressRegion *regions, int set, IR *defaultir)
 {
-    IR *ir, *origir;
-    IR *newir;
-    Operand *opsrc, *opdst;
     int i;
-    struct flexbuf comment;
-    int byte_hits, word_hits, tuple_hits;
-    int misses = 0;
-    
-    byte_hits = word_hits = 0;
-    tuple_hits = 0;
     
     flexbuf_init(&instrcount, 1024);
-    flexbuf_init(&srccount, 1024);
-    flexbuf_init(&dstcount, 1024);
-    flexbuf_init(&comment, 1024);
-    
-    for (ir = irl->head; ir; ir = ir->next) {
-        if (ir->opc >= OPC_GENERIC) {
-            // not an opcode we're comfortable with
+    for (i = 0; i < n; i++) {
+        if (!IsCompressible(info[i].ir) || info[i].paired) {
+            continue;
+        }
+        if (set >= 0 && regions[info[i].region].set != set) {
             continue;
         }
-        if (!ir->instr || ir->instr->ops != TWO_OPERANDS) {
+        RecordInstr(&instrcount, (void *)info[i].ir);
+    }
+    SortPrint("instructions", &instrcount, DoPrintIR, (void **)table, (void *)defaultir);
+    flexbuf_delete(&instrcount);
+}
+
+//
+// pick the most popular instructions/operands in the hub code for the
+// dictionary; if "split" is set the two halves of the instruction
+// table are picked separately for the regions using each of them
+//
+static void
+BuildDict(CompressDict *dict, CompressInfo *info, int n, CompressRegion *regions, int split)
+{
+    Operand *opsrc, *opdst;
+    IR *ir;
+    IR *table[MAX_COMPRESS];
+    int i;
+    
+    flexbuf_init(&srccount, 1024);
+    flexbuf_init(&dstcount, 1024);
+    for (i = 0; i < n; i++) {
+        ir = info[i].ir;
+        if (!IsCompressible(ir) || info[i].paired) {
             continue;
         }
-        RecordInstr(&instrcount, (void *)ir);
         RecordOperand(&dstcount, (void *)ir->dst);
         RecordOperand(&srccount, (void *)ir->src);
     }
@@ -249,94 +384,604 @@ void IRCompress(IRList *irl, IRList *kernel)
     ir = NewIR(OPC_MOV);
     ir->src = opsrc;
     ir->dst = opdst;
-    SortPrint("instructions", &instrcount, DoPrintIR, (void **)cinstr_table, (void *)ir);
-    SortPrint("dst operands:", &dstcount, DoPrintOp, (void **)cdst_table, (void *)opdst);
-    SortPrint("src operands:", &srccount, DoPrintOp, (void **)csrc_table, (void *)opsrc);
-    // now add 32 instructions to COMPRESS_TABLE in the kernel
-    EmitNamedCogLabel(kernel, "COMPRESS_TABLE");
+    if (split) {
+        CountInstrs(table, info, n, regions, 0, ir);
+        memcpy(&dict->instr[0], table, INSTR_SET_SIZE * sizeof(IR *));
+        CountInstrs(table, info, n, regions, 1, ir);
+        memcpy(&dict->instr[INSTR_SET_SIZE], table, INSTR_SET_SIZE * sizeof(IR *));
+    } else {
+        CountInstrs(dict->instr, info, n, regions, -1, ir);
+    }
+    SortPrint("dst operands:", &dstcount, DoPrintOp, (void **)dict->dst, (void *)opdst);
+    SortPrint("src operands:", &srccount, DoPrintOp, (void **)dict->src, (void *)opsrc);
+    flexbuf_delete(&srccount);
+    flexbuf_delete(&dstcount);
+}
+
+//
+// find the size in bytes an instruction compresses to with half "set"
+// of dictionary "dict", and the clocks it takes to decode
+//
+static int
+EncodedSize(IR *ir, CompressDict *dict, int set, int *clocks)
+{
+    int instr_idx, dst_idx, src_idx;
+    
+    instr_idx = FindInstr(dict, ir, set);
+    dst_idx = FindPtr((void **)dict->dst, ir->dst, MatchOperand);
+    src_idx = FindPtr((void **)dict->src, ir->src, MatchOperand);
+    if (instr_idx < 16 && dst_idx < 32 && src_idx < 32) {
+        *clocks = CLOCKS_WORD;
+        return 2;
+    }
+    if (instr_idx < 16 && IsSimple9BitOperand(ir->dst) && IsSimple9BitOperand(ir->src)) {
+        *clocks = CLOCKS_TUPLE;
+        return 3;
+    }
+    *clocks = CLOCKS_FULL;
+    return (ir->cond == COND_TRUE) ? 4 : 5;
+}
+
+//
+// find the next IR after position i which produces code, skipping
+// comments; returns n if there is none
+//
+static int
+NextCodeIR(CompressInfo *info, int n, int i)
+{
+    for (i = i+1; i < n; i++) {
+        IROpcode opc = info[i].ir->opc;
+        if (opc != OPC_COMMENT && opc != OPC_LIVE) {
+            break;
+        }
+    }
+    return i;
+}
+
+//
+// find the pair of adjacent instructions, neither already in a pair,
+// which saves the most space with dictionary "dict"; the space it
+// would take in COMPRESS_PAIRS (2 COG longs) is taken off, and pairs
+// which save the same space are ranked by how often they run
+//
+static int
+FindBestPair(PairFreq *best, CompressInfo *info, int n, CompressDict *dict)
+{
+    Flexbuf fb;
+    PairFreq *table;
+    PairFreq newpair;
+    size_t count, k;
+    int i, j;
+    int saved, clocks, clocks2;
+    int found = 0;
+    
+    flexbuf_init(&fb, 1024);
+    for (i = 0; i < n; i++) {
+        if (info[i].paired || !IsPairable(info[i].ir)) {
+            continue;
+        }
+        j = NextCodeIR(info, n, i);
+        if (j == n || info[j].paired || !IsPairable(info[j].ir)) {
+            continue;
+        }
+        saved = EncodedSize(info[i].ir, dict, 0, &clocks) + EncodedSize(info[j].ir, dict, 0, &clocks2) - 1;
+        count = flexbuf_curlen(&fb) / sizeof(PairFreq);
+        table = (PairFreq *)flexbuf_peek(&fb);
+        for (k = 0; k < count; k++) {
+            if (MatchWholeIR(table[k].first, info[i].ir) && MatchWholeIR(table[k].second, info[j].ir)) {
+                break;
+            }
+        }
+        if (k == count) {
+            newpair.first = info[i].ir;
+            newpair.second = info[j].ir;
+            newpair.saved = -8;
+            newpair.weight = 0;
+            flexbuf_addmem(&fb, (char *)&newpair, sizeof(newpair));
+            table = (PairFreq *)flexbuf_peek(&fb);
+        }
+        table[k].saved += saved;
+        table[k].weight += info[i].weight * (clocks + clocks2 - CLOCKS_PAIR);
+        // a run of the same instruction has only half as many pairs
+        if (MatchWholeIR(info[i].ir, info[j].ir)) {
+            i = j;
+        }
+    }
+    count = flexbuf_curlen(&fb) / sizeof(PairFreq);
+    table = (PairFreq *)flexbuf_peek(&fb);
+    for (k = 0; k < count; k++) {
+        if (!found || table[k].saved > best->saved
+            || (table[k].saved == best->saved && table[k].weight > best->weight))
+        {
+            *best = table[k];
+            found = 1;
+        }
+    }
+    flexbuf_delete(&fb);
+    return found;
+}
+
+//
+// choose pairs of adjacent instructions to get single byte codes, one
+// at a time so that overlapping pairs are not counted twice; returns
+// the number of pairs chosen
+//
+static int
+ChoosePairs(PairFreq *pairs, CompressInfo *info, int n, CompressDict *dict)
+{
+    int i, j, npairs;
+    int total = 0;
+    PairFreq best;
+    
+    npairs = 0;
+    while (npairs < MAX_PAIRS && FindBestPair(&best, info, n, dict)) {
+        if (best.saved < 4) {
+            break;
+        }
+        total += best.saved;
+        pairs[npairs++] = best;
+        // mark the places it is used
+        for (i = 0; i < n; i++) {
+            if (info[i].paired || !IsPairable(info[i].ir)) {
+                continue;
+            }
+            j = NextCodeIR(info, n, i);
+            if (j == n || info[j].paired) {
+                continue;
+            }
+            if (MatchWholeIR(best.first, info[i].ir) && MatchWholeIR(best.second, info[j].ir)) {
+                info[i].pair = npairs;
+                info[i].paired = info[j].paired = 1;
+            }
+        }
+    }
+    if (npairs > 0 && total <= PAIR_CODE_SIZE) {
+        // not enough to pay for the code that runs them
+        for (i = 0; i < n; i++) {
+            info[i].pair = info[i].paired = 0;
+        }
+        npairs = 0;
+    }
+    return npairs;
+}
+
+//
+// find the hub functions, so we know where each region starts
+//
+static Function *
+FindFunctionEntry(Flexbuf *funcs, Operand *label)
+{
+    size_t count = flexbuf_curlen(funcs) / sizeof(Function *);
+    Function **table = (Function **)flexbuf_peek(funcs);
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (FuncData(table[i])->asmname == label) {
+            return table[i];
+        }
+    }
+    return NULL;
+}
+
+static void
+CollectFunctions(Flexbuf *funcs, Module *P)
+{
+    Function *f;
+    for (f = P->functions; f; f = f->next) {
+        if (f->bedata && FuncData(f)->asmname) {
+            flexbuf_addmem(funcs, (char *)&f, sizeof(f));
+        }
+    }
+}
+
+static int
+IsSetjmpCall(IR *ir)
+{
+    return ir->opc == OPC_CALL && ir->dst && ir->dst->kind == IMM_COG_LABEL && !strcmp(ir->dst->name, "__setjmp");
+}
+
+//
+// code using the second half of the table has to switch back to the
+// first around a call if the code called may run hub code, or (for
+// __setjmp) may come back from anywhere through __longjmp
+//
+static int
+CallNeedsSelect(Flexbuf *funcs, IR *ir)
+{
+    Operand *dst = ir->dst;
+    if (!dst || dst->kind != IMM_COG_LABEL) {
+        return 1;
+    }
+    if (IsSetjmpCall(ir)) {
+        return 1;
+    }
+    // a function placed in COG may call hub functions
+    return FindFunctionEntry(funcs, dst) != NULL;
+}
+
+static int
+IsFunctionEntry(CompressRegion *r, IR *ir)
+{
+    return ir->opc == OPC_LABEL && r->func && ir->dst == FuncData(r->func)->asmname;
+}
+
+//
+// count the bytes which select the half of the table around "ir", if
+// its function uses half "set": for the second half, one on entry, one
+// before each return, and one before and after calls; with the first
+// half __setjmp is followed by one
+//
+static int
+NumSelects(Flexbuf *funcs, CompressRegion *r, int set, IR *ir)
+{
+    if (set == 0) {
+        return IsSetjmpCall(ir) ? 1 : 0;
+    }
+    if (IsFunctionEntry(r, ir) || ir->opc == OPC_RET) {
+        return 1;
+    }
+    if (ir->opc == OPC_CALL && CallNeedsSelect(funcs, ir)) {
+        return 2;
+    }
+    return 0;
+}
+
+//
+// work out how big each region is with each half of the table,
+// and the total size
+//
+static int
+RegionSizes(CompressRegion *regions, int nregions, CompressInfo *info, int n, CompressDict *dict, Flexbuf *funcs, int split)
+{
+    int i, set;
+    int clocks;
+    int total = 0;
+    CompressRegion *r;
+    
+    for (i = 0; i < nregions; i++) {
+        regions[i].size[0] = regions[i].size[1] = 0;
+    }
+    for (i = 0; i < n; i++) {
+        r = &regions[info[i].region];
+        if (info[i].pair) {
+            r->size[0]++;
+            r->size[1]++;
+            continue;
+        }
+        if (info[i].paired) {
+            continue;
+        }
+        for (set = 0; set < 2; set++) {
+            if (split) {
+                r->size[set] += NumSelects(funcs, r, set, info[i].ir);
+            }
+            if (IsCompressible(info[i].ir)) {
+                r->size[set] += EncodedSize(info[i].ir, dict, split ? set : 0, &clocks);
+            }
+        }
+    }
+    for (i = 0; i < nregions; i++) {
+        total += regions[i].size[regions[i].set];
+    }
+    return total;
+}
+
+static void
+EmitDict(IRList *kernel, CompressDict *dict)
+{
+    Operand *opsrc, *opdst;
+    IR *ir, *origir;
+    int i;
     
     for (i = 0; i < MAX_COMPRESS; i++) {
-        opdst = cdst_table[i];
-        opsrc = csrc_table[i];
-        origir = cinstr_table[i];
+        opdst = dict->dst[i];
+        opsrc = dict->src[i];
+        origir = dict->instr[i];
         ir = EmitOp2(kernel, origir->opc, opdst, opsrc);
         ir->flags = origir->flags;
         ir->cond = origir->cond;
         ir->srceffect = origir->srceffect;
         ir->dsteffect = origir->dsteffect;
     }
+}
+
+static IR *
+InsertByte(IRList *irl, IR *after, int val)
+{
+    IR *newir = NewIR(OPC_BYTE);
+    newir->dst = NewImmediate(val);
+    InsertAfterIR(irl, after, newir);
+    return newir;
+}
+
+// replace an instruction by a comment showing what it was
+static IR *
+ReplaceWithComment(IRList *irl, IR *ir, struct flexbuf *comment)
+{
+    IR *newir;
+
+    DoAssembleIR(comment, ir, NULL);
+    flexbuf_addchar(comment, 0);
+    newir = NewIR(OPC_COMMENT);
+    newir->dst = NewOperand(IMM_STRING, flexbuf_get(comment), 0);
+    newir->src = NULL;
+    newir->instr = NULL;
+    InsertAfterIR(irl, ir, newir);
+    DeleteIR(irl, ir);
+    return newir;
+}
+
+//
+// walk through and record the most popular instructions/operands in the
+// list "irl" into the list "kernel"
+//
+// Pairs of instructions which occur often get single byte codes. The
+// instruction table has room for 32 instructions but the compressed
+// forms can only name 16, so functions may switch to the second half;
+// which functions do is found by starting with the ones estimated to
+// run most often (loops, or a hot profile) and then moving each function
+// to the half that makes it smaller until nothing changes.
+//
+int gl_printstats = 0;
+
+#define MAX_SPLIT_PASSES 4
+
+void IRCompress(IRList *irl, IRList *kernel)
+{
+    IR *ir, *lastir;
+    CompressInfo *info;
+    CompressRegion *regions;
+    CompressDict dict, dictsplit, dictstatic;
+    PairFreq pairs[MAX_PAIRS];
+    Flexbuf funcs;
+    Flexbuf regionbuf;
+    struct flexbuf comment;
+    Module *P;
+    Function *f;
+    int *depth;
+    int n, nregions, npairs;
+    int i, j, k, d, w;
+    int clocks;
+    int size_all, size_split, size_static, size_new, ninstrs;
+    long long clocks_static, clocks_new, totalweight;
+    int nsplit, changed;
+    int useSplit;
+    int byte_hits, word_hits, tuple_hits, pair_hits;
+    int misses = 0;
+    
+    byte_hits = word_hits = 0;
+    tuple_hits = pair_hits = 0;
+
+    flexbuf_init(&comment, 1024);
+    flexbuf_init(&funcs, 1024);
+    for (P = allparse; P; P = P->next) {
+        CollectFunctions(&funcs, P);
+    }
+    CollectFunctions(&funcs, globalModule);
+
+    // gather up the IR and split it into functions
+    n = 0;
+    for (ir = irl->head; ir; ir = ir->next) {
+        n++;
+    }
+    info = (CompressInfo *)calloc(n+1, sizeof(*info));
+    depth = (int *)calloc(n+1, sizeof(*depth));
+    flexbuf_init(&regionbuf, 1024);
+    {
+        CompressRegion r;
+        memset(&r, 0, sizeof(r));
+        flexbuf_addmem(&regionbuf, (char *)&r, sizeof(r));
+    }
+    nregions = 1;
+    i = 0;
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst && ir->dst->kind == IMM_HUB_LABEL) {
+            f = FindFunctionEntry(&funcs, ir->dst);
+            if (f) {
+                CompressRegion r;
+                memset(&r, 0, sizeof(r));
+                r.func = f;
+                flexbuf_addmem(&regionbuf, (char *)&r, sizeof(r));
+                nregions++;
+            }
+        }
+        info[i].ir = ir;
+        info[i].region = nregions-1;
+        i++;
+    }
+    regions = (CompressRegion *)flexbuf_peek(&regionbuf);
+
+    // find the loops: a branch back to a label encloses everything
+    // from the label to the branch
+    for (i = 0; i < n; i++) {
+        Operand *target = NULL;
+        ir = info[i].ir;
+        if (ir->opc == OPC_JUMP) {
+            target = ir->dst;
+        } else if (ir->opc == OPC_DJNZ) {
+            target = ir->src;
+        }
+        if (!target || target->kind != IMM_HUB_LABEL) {
+            continue;
+        }
+        for (j = i; j >= 0 && info[j].region == info[i].region; --j) {
+            if (info[j].ir->opc == OPC_LABEL && info[j].ir->dst == target) {
+                depth[j]++;
+                depth[i+1]--;
+                break;
+            }
+        }
+    }
+    // estimate how often each instruction runs
+    d = 0;
+    for (i = 0; i < n; i++) {
+        CompressRegion *r = &regions[info[i].region];
+        int heat = r->func ? ProfileFunctionHeat(r->func) : 0;
+        d += depth[i];
+        w = 1 << (3 * (d < MAX_LOOP_DEPTH ? d : MAX_LOOP_DEPTH));
+        if (heat > 0) {
+            w *= 8;
+        }
+        info[i].weight = w;
+        // the code before the first function is entered from COG,
+        // so it always uses the first half of the table
+        if (r->func && heat >= 0 && (d > 0 || heat > 0)) {
+            r->set = 1;
+        }
+    }
+    free(depth);
+
+    // for comparison: the single dictionary without pairs
+    BuildDict(&dictstatic, info, n, regions, 0);
+    size_static = ninstrs = 0;
+    clocks_static = totalweight = 0;
+    for (i = 0; i < n; i++) {
+        if (IsCompressible(info[i].ir)) {
+            size_static += EncodedSize(info[i].ir, &dictstatic, 0, &clocks);
+            clocks_static += clocks * info[i].weight;
+            totalweight += info[i].weight;
+            ninstrs++;
+        }
+    }
+    
+    // pick the pairs, and then the dictionary again without the
+    // instructions that went into pairs
+    npairs = ChoosePairs(pairs, info, n, &dictstatic);
+    if (npairs > 0) {
+        BuildDict(&dict, info, n, regions, 0);
+    } else {
+        dict = dictstatic;
+    }
+
+    // now see whether using both halves of the instruction table helps
+    size_split = 0;
+    for (k = 0; k < MAX_SPLIT_PASSES; k++) {
+        BuildDict(&dictsplit, info, n, regions, 1);
+        size_split = RegionSizes(regions, nregions, info, n, &dictsplit, &funcs, 1);
+        changed = 0;
+        for (i = 1; i < nregions; i++) {
+            int best = regions[i].size[1] < regions[i].size[0];
+            if (best != regions[i].set) {
+                regions[i].set = best;
+                changed = 1;
+            }
+        }
+        if (!changed) {
+            break;
+        }
+    }
+    if (changed) {
+        // make sure the sizes match the dictionary we will use
+        BuildDict(&dictsplit, info, n, regions, 1);
+        size_split = RegionSizes(regions, nregions, info, n, &dictsplit, &funcs, 1);
+    }
+    nsplit = 0;
+    for (i = 1; i < nregions; i++) {
+        nsplit += regions[i].set;
+    }
+    size_all = RegionSizes(regions, nregions, info, n, &dict, &funcs, 0);
+    useSplit = 0;
+    if (nsplit > 0) {
+        int cost = (npairs == 0) ? PAIR_CODE_SIZE : 0;
+        useSplit = (size_split + cost < size_all);
+    }
+    if (useSplit) {
+        dict = dictsplit;
+    } else {
+        for (i = 0; i < nregions; i++) {
+            regions[i].set = 0;
+        }
+    }
+    
+    // now add the dictionary and pairs to the kernel
+    if (npairs > 0 || useSplit) {
+        EmitOp1(kernel, OPC_LITERAL, NewOperand(IMM_STRING, compress_pair_code, 0));
+    } else {
+        EmitOp1(kernel, OPC_LITERAL, NewOperand(IMM_STRING, "handle_pair\n", 0));
+    }
+    EmitNamedCogLabel(kernel, "COMPRESS_TABLE");
+    EmitDict(kernel, &dict);
+    EmitNamedCogLabel(kernel, "COMPRESS_PAIRS");
+    for (k = 0; k < npairs; k++) {
+        IR *origir;
+        for (j = 0; j < 2; j++) {
+            origir = j ? pairs[k].second : pairs[k].first;
+            ir = EmitOp2(kernel, origir->opc, origir->dst, origir->src);
+            ir->flags = origir->flags;
+            ir->cond = origir->cond;
+        }
+    }
 
     // now go back and re-write matching instructions...
-    ir = irl->head;
-    while (ir) {
+    size_new = 0;
+    clocks_new = 0;
+    for (i = 0; i < n; i++) {
         int instr_idx;
         int dst_idx;
         int src_idx;
         uint8_t byte0, byte1;
-        origir = ir->next;
-        if (ir->opc >= OPC_GENERIC) {
-            // not an opcode we're comfortable with
-            ir = origir;
+        CompressRegion *r = &regions[info[i].region];
+        
+        if (info[i].paired && !info[i].pair) {
+            // the second of a pair, already replaced
+            continue;
+        }
+        ir = info[i].ir;
+        if (useSplit && NumSelects(&funcs, r, r->set, ir)) {
+            clocks_new += CLOCKS_SELECT * NumSelects(&funcs, r, r->set, ir) * info[i].weight;
+            if (r->set == 0) {
+                // __longjmp may come back here from code using the
+                // other half of the table
+                InsertByte(irl, ir, SELECT_SET0);
+            } else if (ir->opc == OPC_LABEL) {
+                InsertByte(irl, ir, SELECT_SET1);
+            } else if (ir->opc == OPC_RET) {
+                InsertByte(irl, ir->prev, SELECT_SET0);
+            } else {
+                // the code called expects the first half
+                InsertByte(irl, ir->prev, SELECT_SET0);
+                InsertByte(irl, ir, SELECT_SET1);
+            }
+            continue;
+        }
+        if (info[i].pair) {
+            j = NextCodeIR(info, n, i);
+            lastir = ReplaceWithComment(irl, info[j].ir, &comment);
+            ReplaceWithComment(irl, ir, &comment);
+            InsertByte(irl, lastir, PAIR_BYTE + info[i].pair);
+            size_new++;
+            clocks_new += CLOCKS_PAIR * info[i].weight;
+            pair_hits++;
             continue;
         }
-        if (!ir->instr || ir->instr->ops != TWO_OPERANDS) {
-            ir = origir;
+        if (!IsCompressible(ir)) {
             continue;
         }
-        instr_idx = FindPtr((void **)cinstr_table, ir, MatchIR);
-        dst_idx = FindPtr((void **)cdst_table, ir->dst, MatchOperand);
-        src_idx = FindPtr((void **)csrc_table, ir->src, MatchOperand);
+        size_new += EncodedSize(ir, &dict, r->set, &clocks);
+        clocks_new += clocks * info[i].weight;
+        instr_idx = FindInstr(&dict, ir, r->set);
+        dst_idx = FindPtr((void **)dict.dst, ir->dst, MatchOperand);
+        src_idx = FindPtr((void **)dict.src, ir->src, MatchOperand);
         // 4 bits for instruction, 5 bits each for src and dst
         if (instr_idx < 16 && dst_idx < 32 && src_idx < 32) {
             word_hits++;
-            DoAssembleIR(&comment, ir, NULL);
-            flexbuf_addchar(&comment, 0);
-            newir = NewIR(OPC_COMMENT);
-            newir->opc = OPC_COMMENT;
-            newir->dst = NewOperand(IMM_STRING, flexbuf_get(&comment), 0);
-            newir->src = NULL;
-            newir->instr = NULL;
-            InsertAfterIR(irl, ir, newir);
-            DeleteIR(irl, ir);
-            ir = newir;
+            ir = ReplaceWithComment(irl, ir, &comment);
             if (instr_idx < 2 && dst_idx < 8 && src_idx < 8) {
-#ifdef NEVER                
                 // 1 bit for instruction, 3 bits each for dst and src
                 // no longer supported, but for debug keep track
-                byte0 = (instr_idx << 6) + (dst_idx << 3) + src_idx;
-                newir = NewIR(OPC_BYTE);
-                newir->dst = NewImmediate(byte0);
-                InsertAfterIR(irl, ir, newir);
-#endif                
                 byte_hits++;
             }
-            {
-                byte0 = 0x80 + (instr_idx << 2) + (dst_idx >> 3);
-                byte1 = ((dst_idx & 0x7) << 5) + src_idx;
-                newir = NewIR(OPC_BYTE);
-                newir->dst = NewImmediate(byte1);
-                InsertAfterIR(irl, ir, newir);
-                newir = NewIR(OPC_BYTE);
-                newir->dst = NewImmediate(byte0);
-                InsertAfterIR(irl, ir, newir);                
-            }
+            byte0 = 0x80 + (instr_idx << 2) + (dst_idx >> 3);
+            byte1 = ((dst_idx & 0x7) << 5) + src_idx;
+            ir = InsertByte(irl, ir, byte0);
+            InsertByte(irl, ir, byte1);
         } else if (instr_idx < 16 && IsSimple9BitOperand(ir->dst) && IsSimple9BitOperand(ir->src)) {
             Operand *src, *dst;
-
+            IR *newir;
+            
             src = ir->src;
             dst = ir->dst;
-            
-            DoAssembleIR(&comment, ir, NULL);
-            flexbuf_addchar(&comment, 0);
-            newir = NewIR(OPC_COMMENT);
-            newir->opc = OPC_COMMENT;
-            newir->dst = NewOperand(IMM_STRING, flexbuf_get(&comment), 0);
-            newir->src = NULL;
-            newir->instr = NULL;
-            InsertAfterIR(irl, ir, newir);
-            DeleteIR(irl, ir);
-            ir = newir;
-            
+            ir = ReplaceWithComment(irl, ir, &comment);
             newir = NewIR(OPC_COMPRESS3);
             newir->dst = dst;
             newir->src = src;
@@ -346,9 +991,23 @@ void IRCompress(IRList *irl, IRList *kernel)
         } else {
             misses++;
         }
-        ir = origir;
+    }
+    if (useSplit) {
+        size_new = size_split;
     }
     if (gl_printstats) {
-        printf("hit %d words, %d tuples, %d short bytes; %d misses\n", word_hits, tuple_hits, byte_hits, misses);
+        if (totalweight == 0) totalweight = 1;
+        if (ninstrs == 0) ninstrs = 1;
+        printf("hit %d words, %d tuples, %d short bytes, %d pairs; %d misses\n", word_hits, tuple_hits, byte_hits, pair_hits, misses);
+        printf("%d instructions: %d bytes (%d%%), about %d clocks each to decode; %d pairs, %d of %d functions use the second half of the table\n",
+               ninstrs, size_new, 100 * size_new / (4 * ninstrs),
+               (int)(clocks_new / totalweight),
+               npairs, useSplit ? nsplit : 0, nregions - 1);
+        printf("without pairs or the second half: %d bytes (%d%%), about %d clocks each\n",
+               size_static, 100 * size_static / (4 * ninstrs),
+               (int)(clocks_static / totalweight));
     }
+    free(info);
+    flexbuf_delete(&regionbuf);
+    flexbuf_delete(&funcs);
 }
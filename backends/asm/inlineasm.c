@@ -41,6 +41,8 @@ extern void ValidateObjbase(void);
 extern Operand *objbase;
 extern void ValidateHeapptr(void);
 extern Operand *heapptr;
+extern void ValidateDataptr(void);
+extern Operand *dataptr;
 extern Operand *resultreg[];
 extern Operand *arg1, *arg2;
 
@@ -117,6 +119,11 @@ CompileInlineOperand(IRList *irl, AST *expr, int *effects, int immflag)
                 r = heapptr;
                 r_address = immflag;
             }
+            else if (!strcmp(name, "__data_ptr")) {
+                ValidateDataptr();
+                r = dataptr;
+                r_address = immflag;
+            }
             else if (!strncmp(name, "result", 6) && isargdigit(name[6]) && !name[7]) {
                 r = GetResultReg( parseargnum(name+6));
                 r_address = immflag;
@@ -15,6 +15,8 @@
 
 // fcache size in longs; -1 means take a guess
 int gl_fcache_size = -1;
+// COG memory (in longs) for functions placed there automatically
+int gl_cogplace_size = 0;
 
 //
 // helper functions
@@ -62,6 +64,9 @@ InstrReadsDst(IR *ir)
   case OPC_GETQY:
   case OPC_GETRND:
   case OPC_GETCT:
+  case OPC_RFBYTE:
+  case OPC_RFWORD:
+  case OPC_RFLONG:
     return false;
   default:
     break;
@@ -81,7 +86,14 @@ InstrSetsDst(IR *ir)
   case OPC_WRLONG:
   case OPC_WRWORD:
   case OPC_WRBYTE:
+  case OPC_QDIV:
   case OPC_QFRAC:
+  case OPC_QMUL:
+  case OPC_RDFAST:
+  case OPC_WRFAST:
+  case OPC_WFBYTE:
+  case OPC_WFWORD:
+  case OPC_WFLONG:
       return false;
   case OPC_CMP:
   case OPC_CMPS:
@@ -98,7 +110,7 @@ InstrSetsDst(IR *ir)
 // jumps and calls are both branches, but sometimes
 // we treat them differently
 
-static bool IsJump(IR *ir)
+bool IsJump(IR *ir)
 {
   switch (ir->opc) {
   case OPC_JUMP:
@@ -122,6 +134,9 @@ static bool IsWrite(IR *ir) {
     case OPC_WRLONG:
     case OPC_WRWORD:
     case OPC_WRBYTE:
+    case OPC_WFLONG:
+    case OPC_WFWORD:
+    case OPC_WFBYTE:
     case OPC_GENERIC:
         return true;
     default:
@@ -429,7 +444,7 @@ IsMathInstr(IR *ir)
     }
 }
 
-extern Operand *mulfunc, *divfunc, *unsdivfunc, *muldiva, *muldivb;
+extern Operand *mulfunc, *unsmulfunc, *divfunc, *unsdivfunc, *muldiva, *muldivb;
 
 
 static bool FuncUsesArg(Operand *func, Operand *arg)
@@ -1216,7 +1231,19 @@ HasSideEffectsOtherThanReg(IR *ir)
     case OPC_COGID:
     case OPC_ADDCT1:
     case OPC_HUBSET:
+    case OPC_QDIV:
     case OPC_QFRAC:
+    case OPC_QMUL:
+    case OPC_GETQX:
+    case OPC_GETQY:
+    case OPC_RDFAST:
+    case OPC_WRFAST:
+    case OPC_RFBYTE:
+    case OPC_RFWORD:
+    case OPC_RFLONG:
+    case OPC_WFBYTE:
+    case OPC_WFWORD:
+    case OPC_WFLONG:
         return true;
     default:
         return false;
@@ -2835,6 +2862,573 @@ OptimizeJumps(IRList *irl)
     return change;
 }
 
+//
+// CORDIC scheduling for P2
+// The CORDIC takes about 55 cycles to produce a result, but will accept
+// a new command every 8 cycles, and the results come back in order.
+// So code like:
+//     qmul  a, b
+//     getqx x
+//     ...
+//     qmul  c, d
+//     getqx y
+// can be changed to
+//     qmul  a, b
+//     qmul  c, d
+//     getqx x
+//     ...
+//     getqx y
+// provided c and d do not change in between. Once a result is
+// ready it must be read before the next one arrives (8 cycles later),
+// so the reads of all but the last command in flight have to be
+// next to each other; this means we can only keep adding commands
+// while there is nothing between the GETQ instructions.
+//
+static bool
+IsCordicCommand(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_QMUL:
+    case OPC_QDIV:
+    case OPC_QFRAC:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool
+IsCordicGet(IR *ir)
+{
+    return ir && (ir->opc == OPC_GETQX || ir->opc == OPC_GETQY) && ir->cond == COND_TRUE;
+}
+
+static IR *
+NextInstr(IR *ir)
+{
+    ir = ir->next;
+    while (ir && IsDummy(ir)) {
+        ir = ir->next;
+    }
+    return ir;
+}
+
+// skip over the GETQX and/or GETQY which read one CORDIC result
+static IR *
+SkipCordicGets(IR *ir)
+{
+    IROpcode first = ir->opc;
+    ir = NextInstr(ir);
+    if (IsCordicGet(ir) && ir->opc != first) {
+        ir = NextInstr(ir);
+    }
+    return ir;
+}
+
+static int
+OptimizeCordic(IRList *irl)
+{
+    IR *ir, *prev, *last, *getstart;
+    IR *p, *q, *y;
+    bool xempty;
+    int change = 0;
+
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (!IsCordicCommand(ir) || ir->cond != COND_TRUE) {
+            continue;
+        }
+        // make sure nothing else is in flight (or needs a SETQ)
+        prev = ir->prev;
+        while (prev && IsDummy(prev)) {
+            prev = prev->prev;
+        }
+        if (prev && (IsCordicCommand(prev) || prev->opc >= OPC_GENERIC)) {
+            continue;
+        }
+        getstart = NextInstr(ir);
+        if (!IsCordicGet(getstart)) {
+            continue;
+        }
+        last = ir;
+        p = SkipCordicGets(getstart);
+        for(;;) {
+            // look for the next command in this basic block
+            xempty = true;
+            for (q = p; q; q = q->next) {
+                if (IsDummy(q)) continue;
+                if (IsCordicCommand(q)) break;
+                if (IsLabel(q) || IsBranch(q) || q->opc >= OPC_GENERIC
+                    || q->opc == OPC_GETQX || q->opc == OPC_GETQY)
+                {
+                    q = NULL;
+                    break;
+                }
+                xempty = false;
+            }
+            if (!q || q->cond != COND_TRUE || !IsCordicGet(NextInstr(q))) {
+                break;
+            }
+            // its operands must be ready when we issue it
+            for (y = getstart; y != q; y = y->next) {
+                if (IsDummy(y)) continue;
+                if (InstrModifies(y, q->dst) || InstrModifies(y, q->src)) {
+                    break;
+                }
+            }
+            if (y != q) {
+                break;
+            }
+            p = SkipCordicGets(NextInstr(q));
+            DeleteIR(irl, q);
+            q->next = NULL;
+            InsertAfterIR(irl, last, q);
+            last = q;
+            change = 1;
+            if (!xempty) {
+                // the previous result will not be read in time if
+                // we issue another command
+                break;
+            }
+        }
+        ir = last;
+    }
+    return change;
+}
+
+//
+// hub timing aware scheduling
+//
+// within a basic block, instructions which do not depend on a hub
+// access are moved around it so that they run while the cog would
+// otherwise be waiting for the hub
+//
+// on P1 a cog gets a hub window every 16 clocks; a hub access which
+// starts in its window takes 8 clocks, which leaves room for exactly
+// two ordinary instructions before the next window comes around
+//
+// on P2 each long of hub memory belongs to one of 8 slices, and the
+// slice a cog can reach moves on by one every clock; reads of longs
+// next to each other go best back to back, whereas (for example) a
+// write followed by a write to the next long leaves time for three
+// instructions in between
+//
+// we only know how two addresses are related if they come from the
+// same register (plus or minus constants), so the cycle counts here
+// are estimates
+//
+
+#define SCHED_MAX_BLOCK 48
+
+typedef struct SchedNode {
+    IR *ir;
+    IR *first;        // first of any comments just before ir, which move with it
+    bool hub;         // true for a hub memory access
+    bool write;       // true for a hub write
+    Operand *base;    // register holding the hub address
+    int basever;      // which value of base the address is relative to
+    int offset;       // constant added to that value
+    bool feedshub;    // a later hub access depends on this instruction
+    int npreds;       // predecessors not scheduled yet
+    bool done;
+} SchedNode;
+
+typedef struct SchedState {
+    int n;
+    int nhub;
+    SchedNode node[SCHED_MAX_BLOCK];
+    // dep[i][j] is set if j has to come after i
+    unsigned char dep[SCHED_MAX_BLOCK][SCHED_MAX_BLOCK];
+} SchedState;
+
+static bool
+IsSchedOperand(IR *ir, Operand *op, bool isdst)
+{
+    if (!op) {
+        return true;
+    }
+    switch (op->kind) {
+    case REG_REG:
+    case REG_LOCAL:
+    case REG_TEMP:
+    case REG_ARG:
+    case REG_HUBPTR:
+    case REG_COGPTR:
+        return true;
+    case IMM_INT:
+        // may be a register holding a constant
+        return !isdst || !InstrSetsDst(ir);
+    case IMM_COG_LABEL:
+    case IMM_HUB_LABEL:
+        return !isdst;
+    default:
+        return false;
+    }
+}
+
+// check for instructions the scheduler is allowed to move
+static bool
+IsSchedulable(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_ABS:
+    case OPC_ADD:
+    case OPC_AND:
+    case OPC_ANDN:
+    case OPC_CMP:
+    case OPC_CMPS:
+    case OPC_MAXS:
+    case OPC_MINS:
+    case OPC_MAXU:
+    case OPC_MINU:
+    case OPC_MOV:
+    case OPC_MUXC:
+    case OPC_MUXNC:
+    case OPC_MUXNZ:
+    case OPC_MUXZ:
+    case OPC_NEG:
+    case OPC_OR:
+    case OPC_RDBYTE:
+    case OPC_RDLONG:
+    case OPC_RDWORD:
+    case OPC_ROL:
+    case OPC_ROR:
+    case OPC_SAR:
+    case OPC_SHL:
+    case OPC_SHR:
+    case OPC_SUB:
+    case OPC_TEST:
+    case OPC_TESTN:
+    case OPC_WRBYTE:
+    case OPC_WRLONG:
+    case OPC_WRWORD:
+    case OPC_XOR:
+    case OPC_BITH:
+    case OPC_BITL:
+    case OPC_BITNOT:
+    case OPC_BMASK:
+    case OPC_DECOD:
+    case OPC_ENCOD:
+    case OPC_NOT:
+        break;
+    default:
+        return false;
+    }
+    if (ir->src2 || InstrIsVolatile(ir) || ir->fcache) {
+        return false;
+    }
+    if (ir->srceffect != OPEFFECT_NONE || ir->dsteffect != OPEFFECT_NONE) {
+        return false;
+    }
+    return IsSchedOperand(ir, ir->dst, true) && IsSchedOperand(ir, ir->src, false);
+}
+
+static bool
+SchedReads(IR *ir, Operand *reg)
+{
+    return reg && (ir->src == reg || (ir->dst == reg && InstrReadsDst(ir)));
+}
+
+static Operand *
+SchedWrites(IR *ir)
+{
+    return InstrSetsDst(ir) ? ir->dst : NULL;
+}
+
+static bool
+SchedUsesC(IR *ir)
+{
+    return InstrUsesFlags(ir, FLAG_WC) || (ir->flags & (FLAG_ANDC|FLAG_ORC|FLAG_XORC));
+}
+
+static bool
+SchedUsesZ(IR *ir)
+{
+    return InstrUsesFlags(ir, FLAG_WZ) || (ir->flags & (FLAG_ANDZ|FLAG_ORZ|FLAG_XORZ));
+}
+
+// true if instruction b (which follows a) has to stay after a
+static bool
+SchedDepends(SchedNode *a, SchedNode *b)
+{
+    IR *x = a->ir;
+    IR *y = b->ir;
+    Operand *wx = SchedWrites(x);
+    Operand *wy = SchedWrites(y);
+
+    if (a->hub && b->hub) {
+        // keep hub accesses in order
+        return true;
+    }
+    if (wx && (wx == wy || SchedReads(y, wx))) {
+        return true;
+    }
+    if (wy && SchedReads(x, wy)) {
+        return true;
+    }
+    if (InstrSetsFlags(x, FLAG_CSET) && (SchedUsesC(y) || InstrSetsFlags(y, FLAG_CSET))) {
+        return true;
+    }
+    if (InstrSetsFlags(x, FLAG_ZSET) && (SchedUsesZ(y) || InstrSetsFlags(y, FLAG_ZSET))) {
+        return true;
+    }
+    if ((SchedUsesC(x) && InstrSetsFlags(y, FLAG_CSET))
+        || (SchedUsesZ(x) && InstrSetsFlags(y, FLAG_ZSET)))
+    {
+        return true;
+    }
+    return false;
+}
+
+//
+// estimate the clocks taken by the first count instructions of order
+// (if hubtime is non-NULL it gets the clock at which each hub access
+// was serviced)
+//
+static int
+SchedClocks(SchedState *S, int *order, int count)
+{
+    int hubtime[SCHED_MAX_BLOCK];
+    int t = 0;
+    int window = -1;
+    int i, j, wait;
+    SchedNode *x, *y;
+
+    for (i = 0; i < count; i++) {
+        x = &S->node[order[i]];
+        if (!x->hub) {
+            t += gl_p2 ? 2 : 4;
+            continue;
+        }
+        if (!gl_p2) {
+            // assume the first access is in step with the hub
+            if (window < 0) {
+                window = t;
+            }
+            wait = ((window - t) % 16 + 16) % 16;
+            t += wait + 8;
+            continue;
+        }
+        // find the previous access relative to the same address
+        wait = 0;
+        for (j = i-1; j >= 0; --j) {
+            y = &S->node[order[j]];
+            if (!y->hub || y->base != x->base || y->basever != x->basever) continue;
+            if (((x->offset | y->offset) & 3) == 0) {
+                int slice = ((x->offset - y->offset) >> 2) & 7;
+                wait = ((hubtime[j] + slice - t) % 8 + 8) % 8;
+            }
+            break;
+        }
+        hubtime[i] = t + wait;
+        t += wait + (x->write ? 3 : 9);
+    }
+    return t;
+}
+
+//
+// pick an order for the block; returns the estimated number of
+// clocks saved (0 if the original order is as good as any we found)
+//
+static int
+ScheduleBlock(IRList *irl, SchedState *S)
+{
+    int order[SCHED_MAX_BLOCK];
+    int orig[SCHED_MAX_BLOCK];
+    int i, j, k, pick, hub, base;
+    int oldclocks, newclocks;
+    int alucost = gl_p2 ? 2 : 4;
+    SchedNode *x;
+    IR *prev;
+
+    // find the dependencies
+    for (i = 0; i < S->n; i++) {
+        orig[i] = i;
+        S->node[i].npreds = 0;
+        S->node[i].done = false;
+        S->node[i].feedshub = false;
+    }
+    for (j = S->n - 1; j >= 0; --j) {
+        for (i = 0; i < j; i++) {
+            S->dep[i][j] = SchedDepends(&S->node[i], &S->node[j]);
+            if (S->dep[i][j]) {
+                S->node[j].npreds++;
+                if (S->node[j].hub || S->node[j].feedshub) {
+                    S->node[i].feedshub = true;
+                }
+            }
+        }
+    }
+
+    // list scheduling: issue hub accesses when they will not have to
+    // wait, and fill the waits with other instructions
+    for (k = 0; k < S->n; k++) {
+        hub = pick = -1;
+        for (i = 0; i < S->n; i++) {
+            x = &S->node[i];
+            if (x->done || x->npreds) continue;
+            if (x->hub) {
+                hub = i;
+            } else if (pick < 0 || (x->feedshub && !S->node[pick].feedshub)) {
+                pick = i;
+            }
+        }
+        if (hub >= 0 && pick >= 0) {
+            // see how long the hub access would have to wait now
+            order[k] = hub;
+            base = (k > 0) ? SchedClocks(S, order, k) : 0;
+            if (SchedClocks(S, order, k+1) - base - (gl_p2 ? (S->node[hub].write ? 3 : 9) : 8) < alucost) {
+                pick = hub;
+            }
+        } else if (pick < 0) {
+            pick = hub;
+        }
+        order[k] = pick;
+        S->node[pick].done = true;
+        for (j = pick+1; j < S->n; j++) {
+            if (S->dep[pick][j]) {
+                S->node[j].npreds--;
+            }
+        }
+    }
+
+    oldclocks = SchedClocks(S, orig, S->n);
+    newclocks = SchedClocks(S, order, S->n);
+    if (newclocks >= oldclocks) {
+        return 0;
+    }
+    // put the instructions in their new order, each along with the
+    // comments in front of it
+    prev = S->node[0].first->prev;
+    for (i = 0; i < S->n; i++) {
+        x = &S->node[i];
+        if (x->first->prev) {
+            x->first->prev->next = x->ir->next;
+        } else {
+            irl->head = x->ir->next;
+        }
+        if (x->ir->next) {
+            x->ir->next->prev = x->first->prev;
+        } else {
+            irl->tail = x->first->prev;
+        }
+        x->first->prev = NULL;
+        x->ir->next = NULL;
+    }
+    for (i = 0; i < S->n; i++) {
+        x = &S->node[order[i]];
+        InsertAfterIR(irl, prev, x->first);
+        prev = x->ir;
+    }
+    return oldclocks - newclocks;
+}
+
+//
+// work out which register value each hub address is based on
+//
+static void
+FindHubBases(SchedState *S)
+{
+    Operand *reg[SCHED_MAX_BLOCK];
+    int ver[SCHED_MAX_BLOCK];
+    int off[SCHED_MAX_BLOCK];
+    int nregs = 0;
+    int i, r;
+    int nextver = 1;
+    SchedNode *x;
+    Operand *w;
+
+    for (i = 0; i < S->n; i++) {
+        x = &S->node[i];
+        if (x->hub) {
+            x->base = x->ir->src;
+            for (r = 0; r < nregs && reg[r] != x->base; r++)
+                ;
+            x->basever = (r < nregs) ? ver[r] : 0;
+            x->offset = (r < nregs) ? off[r] : 0;
+        }
+        w = SchedWrites(x->ir);
+        if (!w) continue;
+        for (r = 0; r < nregs && reg[r] != w; r++)
+            ;
+        if (r == nregs) {
+            reg[nregs] = w;
+            ver[nregs] = 0;
+            off[nregs] = 0;
+            nregs++;
+        }
+        if (x->ir->cond == COND_TRUE && x->ir->src && x->ir->src->kind == IMM_INT
+            && (x->ir->opc == OPC_ADD || x->ir->opc == OPC_SUB))
+        {
+            off[r] += (x->ir->opc == OPC_ADD) ? x->ir->src->val : -x->ir->src->val;
+        } else {
+            ver[r] = nextver++;
+            off[r] = 0;
+        }
+    }
+}
+
+static int
+FinishSchedBlock(IRList *irl, SchedState *S)
+{
+    int saved = 0;
+
+    if (S->nhub > 0 && S->nhub < S->n && S->n > 2) {
+        FindHubBases(S);
+        saved = ScheduleBlock(irl, S);
+    }
+    S->n = S->nhub = 0;
+    return saved;
+}
+
+//
+// schedule all the basic blocks in irl;
+// returns the estimated number of clocks saved
+//
+static int
+ScheduleHubAccesses(IRList *irl, Function *f)
+{
+    SchedState *S;
+    IR *ir, *ir_next;
+    IR *first = NULL;
+    int saved = 0;
+
+    if (!gl_p2 && !(gl_outputflags & OUTFLAG_COG_CODE) && !(f && f->cog_code)) {
+        // in LMM every instruction is fetched from hub, so the hub
+        // windows are not ours to plan around
+        return 0;
+    }
+    S = (SchedState *)calloc(1, sizeof(*S));
+    for (ir = irl->head; ir; ir = ir_next) {
+        ir_next = ir->next;
+        if (ir->opc == OPC_DUMMY || ir->opc == OPC_COMMENT || (IsDummy(ir) && ir->opc != OPC_LITERAL)) {
+            if (!first) {
+                first = ir;
+            }
+            continue;
+        }
+        if (!IsSchedulable(ir)) {
+            saved += FinishSchedBlock(irl, S);
+            first = NULL;
+            continue;
+        }
+        if (S->n == SCHED_MAX_BLOCK) {
+            saved += FinishSchedBlock(irl, S);
+        }
+        S->node[S->n].ir = ir;
+        S->node[S->n].first = first ? first : ir;
+        first = NULL;
+        S->node[S->n].hub = IsReadWrite(ir);
+        S->node[S->n].write = IsWrite(ir);
+        if (S->node[S->n].hub) {
+            S->nhub++;
+        }
+        S->n++;
+    }
+    saved += FinishSchedBlock(irl, S);
+    free(S);
+    return saved;
+}
+
 // optimize an isolated piece of IRList
 // (typically a function)
 void
@@ -2872,7 +3466,15 @@ again:
     } while (change != 0);
     change = OptimizeTailCalls(irl, f);
     if (change) goto again;
-    
+    if (gl_p2) {
+        OptimizeCordic(irl);
+    }
+    if (gl_optimize_flags & OPT_HUB_SCHEDULE) {
+        int saved = ScheduleHubAccesses(irl, f);
+        if (f && f->bedata) {
+            FuncData(f)->hubClocksSaved += saved;
+        }
+    }
 }
 
 //
@@ -2891,10 +3493,13 @@ OptimizeIRGlobal(IRList *irl)
         }
         ir = ir_next;
     }
-    if (gl_lmm_kind == LMM_KIND_ORIG) {
+    if (gl_lmm_kind == LMM_KIND_ORIG || gl_lmm_kind == LMM_KIND_LRU) {
         // check for fcache
         OptimizeFcache(irl);
     }
+    if (gl_p2 && (gl_optimize_flags & OPT_HUB_FIFO)) {
+        OptimizeCogFifo(irl);
+    }
     // check for usage
     CheckUsage(irl);
 }
@@ -2911,83 +3516,580 @@ NeverInline(Function *f)
 }
 
 //
-// check a function to see if it should be inlined
+// inlining is decided by weighing what a call costs against how much
+// bigger the program gets; all of these costs are in instructions
 //
-#define INLINE_THRESHOLD 4
+#define CALL_COST       3   // the call and the ret, and the jumps they cause
+#define CONSTARG_BONUS  2   // an argument that is a constant may fold away
+#define LOOP_WEIGHT     4   // calls in loops count this many times over
+
+// the total growth (in instructions) allowed for the whole program,
+// and how many instructions a function may grow the program by for
+// each 100 units of time saved
+#define INLINE_BUDGET        128
+#define INLINE_RATIO          25
+#define INLINE_BUDGET_SPEED  2048
+#define INLINE_RATIO_SPEED   400
+
+// functions declared {++inline} are inlined at calls inside loops if
+// they are at most this big (or at every call with -O3), unless we are
+// optimizing for size
+#define INLINE_PREFER_MAX     64
+
+typedef struct InlineCandidate {
+    Function *f;
+    int size;       // size of the function body
+    int growth;     // how much the program grows if f is inlined
+    int benefit;    // how much time we save
+} InlineCandidate;
 
-bool
-ShouldBeInlined(Function *f)
+static struct flexbuf inlineFuncs;
+static int inlineFuncsInit;
+
+//
+// find the size of the function body, or -1 if it cannot be inlined
+//
+static int
+InlineSize(Function *f)
 {
     IR *ir;
     int n = 0;
 
-    if (!(gl_optimize_flags & (OPT_INLINE_SMALLFUNCS|OPT_INLINE_SINGLEUSE))) {
-        return false;
+    if (NeverInline(f)) {
+        return -1;
+    }
+    for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+        if (IsDummy(ir)) continue;
+        // we have to re-label any labels and branches
+        if (IsLabel(ir)) {
+            if (!ir->aux) {
+                // cannot find a unique jump going to this label
+                return -1;
+            }
+            if (!IsTemporaryLabel(ir->dst)) {
+                return -1;
+            }
+            continue; // do not count labels against the cost
+        } else if (IsJump(ir)) {
+            if (!ir->aux) {
+                // cannot find where this jump goes
+                return -1;
+            }
+            if (!IsTemporaryLabel( ((IR *)ir->aux)->dst )) {
+                return -1;
+            }
+        }
+        n++;
+    }
+    return n;
+}
+
+// count the constants moved into argument registers just before a call
+static int
+ConstantArgs(IR *call)
+{
+    IR *ir;
+    int n = 0;
+
+    for (ir = call->prev; ir; ir = ir->prev) {
+        if (IsDummy(ir)) continue;
+        if (ir->opc != OPC_MOV || ir->cond != COND_TRUE || !ir->dst || ir->dst->kind != REG_ARG) {
+            break;
+        }
+        if (ir->src && ir->src->kind == IMM_INT) {
+            n++;
+        }
+    }
+    return n;
+}
+
+//
+// look at the calls made by f, and record how often each function is
+// called and with how many constant arguments
+//
+void
+CountInlineCalls(Function *f)
+{
+    IR *ir;
+    IR *loopend = NULL;
+    Function *g;
+    int weight;
+    int heat = ProfileFunctionHeat(f);
+
+    if (!inlineFuncsInit) {
+        flexbuf_init(&inlineFuncs, 256);
+        inlineFuncsInit = 1;
+    }
+    flexbuf_addmem(&inlineFuncs, (const char *)&f, sizeof(f));
+    for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+        if (ir == loopend) {
+            loopend = NULL;
+        }
+        if (IsLabel(ir) && !loopend && ir->aux && IsJump((IR *)ir->aux)
+            && !IsForwardJump((IR *)ir->aux))
+        {
+            // the start of a loop
+            loopend = (IR *)ir->aux;
+            continue;
+        }
+        if (ir->opc != OPC_CALL || !ir->aux) continue;
+        g = (Function *)ir->aux;
+        if (!g->bedata) continue;
+        if (f->prefer_inline && !g->prefer_inline) {
+            // f is to be inlined everywhere, and anything else it
+            // calls is its slow path; keep that out of line
+            g->no_inline = 1;
+        }
+        weight = loopend ? LOOP_WEIGHT : 1;
+        if (heat == 1) {
+            weight *= LOOP_WEIGHT;
+        } else if (heat == -1) {
+            weight = 0;
+        }
+        FuncData(g)->inlineCalls++;
+        FuncData(g)->inlineWeight += weight;
+        FuncData(g)->inlineConstArgs += weight * ConstantArgs(ir);
+    }
+}
+
+static int
+CompareInlineCandidates(const void *a, const void *b)
+{
+    const InlineCandidate *A = (const InlineCandidate *)a;
+    const InlineCandidate *B = (const InlineCandidate *)b;
+    // best ratio of benefit to growth first
+    long x = (long)B->benefit * A->growth;
+    long y = (long)A->benefit * B->growth;
+    if (x != y) {
+        return (x < y) ? -1 : 1;
+    }
+    return A->size - B->size;
+}
+
+//
+// decide which of the functions passed to CountInlineCalls
+// should be inlined
+//
+// inlining a function that makes the program smaller is always done;
+// otherwise the time saved has to be worth the growth, and the
+// total growth has to stay within the budget for the build:
+// -Os never lets the program grow, and -O3 allows much more
+//
+void
+ChooseInlines(void)
+{
+    Function **funcs;
+    Function *f;
+    InlineCandidate *cand;
+    int nfuncs, ncand;
+    int i;
+    int size, frame, calls, moves, bodysize;
+    int budget, ratio;
+
+    if (!inlineFuncsInit) {
+        return;
+    }
+    nfuncs = flexbuf_curlen(&inlineFuncs) / sizeof(Function *);
+    funcs = (Function **)flexbuf_peek(&inlineFuncs);
+    cand = (InlineCandidate *)calloc(nfuncs + 1, sizeof(InlineCandidate));
+    ncand = 0;
+
+    if (gl_optimize_flags & OPT_OPTIMIZE_SIZE) {
+        budget = 0;
+        ratio = 0;
+    } else if (gl_optimize_flags & OPT_INLINE_AGGRESSIVE) {
+        budget = INLINE_BUDGET_SPEED;
+        ratio = INLINE_RATIO_SPEED;
+    } else {
+        budget = INLINE_BUDGET;
+        ratio = INLINE_RATIO;
+    }
+    if (!(gl_optimize_flags & OPT_INLINE_SMALLFUNCS)) {
+        budget = 0;
+    }
+
+    for (i = 0; i < nfuncs; i++) {
+        f = funcs[i];
+        FuncData(f)->isInline = false;
+        FuncData(f)->isInlineInLoops = false;
+        if (!(gl_optimize_flags & (OPT_INLINE_SMALLFUNCS|OPT_INLINE_SINGLEUSE))) {
+            continue;
+        }
+        size = InlineSize(f);
+        if (size < 0) {
+            continue;
+        }
+        if (f->prefer_inline && size <= INLINE_PREFER_MAX
+            && !(gl_optimize_flags & OPT_OPTIMIZE_SIZE))
+        {
+            FuncData(f)->inlineSize = size;
+            if ((gl_optimize_flags & OPT_INLINE_AGGRESSIVE) || ProfileFunctionHeat(f) == 1) {
+                FuncData(f)->isInline = true;
+            } else {
+                FuncData(f)->isInlineInLoops = true;
+            }
+            continue;
+        }
+        frame = FrameSetupCost(f);
+        calls = FuncData(f)->inlineCalls;
+        // moves into argument registers and out of the result
+        // registers can usually be optimized away once f is inlined
+        moves = f->numparams + f->numresults;
+        if (moves > size) {
+            moves = size;
+        }
+        // each call instruction gets replaced by the body
+        cand[ncand].growth = calls * (size - 1 - moves);
+        if (RemoveIfInlined(f) && (gl_optimize_flags & OPT_INLINE_SINGLEUSE)) {
+            // and the function itself goes away
+            bodysize = size + 1 + frame;
+            cand[ncand].growth -= bodysize;
+        }
+        cand[ncand].benefit = FuncData(f)->inlineWeight * (CALL_COST + frame + moves)
+            + FuncData(f)->inlineConstArgs * CONSTARG_BONUS;
+        switch (ProfileFunctionHeat(f)) {
+        case 1:
+            cand[ncand].benefit *= 2;
+            break;
+        case -1:
+            cand[ncand].benefit = 0;
+            break;
+        default:
+            break;
+        }
+        cand[ncand].f = f;
+        cand[ncand].size = size;
+        FuncData(f)->inlineSize = size;
+        if (cand[ncand].growth <= 0) {
+            FuncData(f)->isInline = true;
+        } else {
+            ncand++;
+        }
+    }
+    qsort(cand, ncand, sizeof(*cand), CompareInlineCandidates);
+    for (i = 0; i < ncand; i++) {
+        if (cand[i].growth > budget) continue;
+        if (100 * cand[i].growth > ratio * cand[i].benefit) continue;
+        FuncData(cand[i].f)->isInline = true;
+        budget -= cand[i].growth;
+    }
+    free(cand);
+    flexbuf_delete(&inlineFuncs);
+    inlineFuncsInit = 0;
+}
+
+//
+// expand the inline calls in f, if that has not been done already
+//
+void
+ExpandFunctionInlines(Function *f)
+{
+    Function *savefunc = curfunc;
+    Module *savemod = current;
+
+    if (FuncData(f)->inlineState != INLINE_NOT_EXPANDED) {
+        return;
+    }
+    FuncData(f)->inlineState = INLINE_EXPANDING;
+    curfunc = f;
+    current = f->module;
+    while (ExpandInlines(FuncIRL(f))) {
+        // may be new opportunities for optimization
+        OptimizeIRLocal(FuncIRL(f), f);
+    }
+    FuncData(f)->inlineState = INLINE_EXPANDED;
+    curfunc = savefunc;
+    current = savemod;
+}
+
+//
+// a call which stops a loop from being run from FCACHE: any call to
+// hub memory, and with --lmm=lru any call at all
+//
+static bool
+CallStopsFcache(IR *ir)
+{
+    return ir->opc == OPC_CALL
+        && (MaybeHubDest(ir->dst) || gl_lmm_kind == LMM_KIND_LRU);
+}
+
+//
+// find the size of f if it can be inlined into a loop which is to
+// run from FCACHE, or -1 if it cannot: it must be a leaf function,
+// apart from calls to the COG support routines
+//
+static int
+FcacheLeafSize(Function *f)
+{
+    IR *ir;
+
+    if (!f || !f->bedata || f->cog_code) {
+        return -1;
+    }
+    ExpandFunctionInlines(f);
+    if (FuncData(f)->inlineState != INLINE_EXPANDED) {
+        return -1;
+    }
+    for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+        if (CallStopsFcache(ir)) {
+            return -1;
+        }
+    }
+    return InlineSize(f);
+}
+
+//
+// see if the loop starting at root could be run from FCACHE once
+// the small leaf functions it calls are inlined into it; returns the
+// end of the loop if so, or NULL if not (or if it makes no such calls)
+//
+static IR *
+FcacheInlineLoop(IR *root)
+{
+    IR *endjmp = (IR *)root->aux;
+    IR *ir;
+    int size = 0;
+    int limit = gl_fcache_size;
+    int n;
+    bool leafcalls = false;
+
+    if (gl_optimize_flags & OPT_OPTIMIZE_SIZE) {
+        return NULL;
+    }
+    if (gl_lmm_kind != LMM_KIND_ORIG && gl_lmm_kind != LMM_KIND_LRU) {
+        return NULL;
+    }
+    if (!curfunc || curfunc->cog_code) {
+        return NULL;
+    }
+    if (limit < 0) {
+        // the final size is not known yet; OptimizeFcache checks
+        // the loop again once it is
+        limit = GuessFcacheSize(NULL);
+    }
+    for (ir = root->next; ir && ir != endjmp; ir = ir->next) {
+        if (IsDummy(ir) || IsLabel(ir)) {
+            continue;
+        }
+        size++;
+        if (CallStopsFcache(ir)) {
+            n = FcacheLeafSize((Function *)ir->aux);
+            if (n < 0) {
+                return NULL;
+            }
+            size += n - 1;
+            leafcalls = true;
+        }
+        if (size >= limit) {
+            return NULL;
+        }
+    }
+    return (ir && leafcalls) ? endjmp : NULL;
+}
+
+//
+// expand function calls inline if appropriate
+// returns 1 if anything was expanded
+int
+ExpandInlines(IRList *irl)
+{
+    Function *f;
+    IR *ir, *ir_next;
+    IR *loopend = NULL;
+    IR *fcacheend = NULL;
+    int change = 0;
+    
+    ir = irl->head;
+    while (ir) {
+        ir_next = ir->next;
+        if (ir == loopend) {
+            loopend = NULL;
+        }
+        if (ir == fcacheend) {
+            fcacheend = NULL;
+        }
+        if (IsLabel(ir) && ir->aux && IsJump((IR *)ir->aux)
+            && !IsForwardJump((IR *)ir->aux))
+        {
+            if (!loopend) {
+                loopend = (IR *)ir->aux;
+            }
+            if (!fcacheend) {
+                // inline small leaf functions called in the loop if
+                // that lets the loop run from FCACHE
+                fcacheend = FcacheInlineLoop(ir);
+            }
+        }
+        if (ir->opc == OPC_CALL) {
+            bool forFcache = fcacheend && CallStopsFcache(ir);
+            f = (Function *)ir->aux;
+            if (f && (FuncData(f)->isInline || (FuncData(f)->isInlineInLoops && loopend) || forFcache)) {
+                int n;
+                // do the inlining inside f first, so that we copy
+                // the final version of f
+                ExpandFunctionInlines(f);
+                n = InlineSize(f);
+                if (n < 0 || FuncData(f)->inlineState != INLINE_EXPANDED
+                    || (n > FuncData(f)->inlineSize && FuncData(f)->inlineCalls > 1
+                        && !(f->prefer_inline && n <= INLINE_PREFER_MAX)
+                        && !forFcache))
+                {
+                    // f is recursive, or inlining other functions into
+                    // it has made it bigger than we planned for (or
+                    // made its labels unsuitable); keep f as a function
+                    FuncData(f)->isInline = false;
+                    FuncData(f)->isInlineInLoops = false;
+                } else {
+                    ReplaceIRWithInline(irl, ir, f);
+                    if (forFcache) {
+                        FuncData(f)->fcacheInlined = true;
+                    }
+                    change = 1;
+                }
+            }
+        }
+        ir = ir_next;
+    }
+    return change;
+}
+
+//
+// P2 hub FIFO streaming
+// a loop which reads (or writes) hub memory through a single pointer
+// that advances by the size of the access each time around can use
+// the FIFO instead of waiting for the hub on every access:
+//
+//     rdfast #0, ptr
+//   loop
+//     rfbyte x           ' was rdbyte x, ptr
+//     add    ptr, #1
+//     ...
+//     jmp    #loop
+//
+// hub execution uses the FIFO too, so this is only possible for loops
+// running from COG or LUT memory; returns the RDFAST/WRFAST that has
+// to go before the loop, or NULL if the loop is not suitable
+//
+
+static IR *
+MakeFifoLoop(IRList *irl, IR *root, bool allowWrite)
+{
+    IR *endjmp = (IR *)root->aux;
+    IR *access = NULL;
+    IR *copy;
+    IR *incr = NULL;
+    IR *ir;
+    IR *fifo;
+    Operand *ptr;
+    IROpcode fifo_opc, opc;
+    int size;
+
+    if (!endjmp || !IsJump(endjmp) || IsForwardJump(endjmp)) {
+        return NULL;
+    }
+    // look for exactly one hub memory access
+    for (ir = root->next; ir != endjmp; ir = ir->next) {
+        if (IsDummy(ir)) continue;
+        if (IsLabel(ir) || ir->opc == OPC_CALL || ir->opc >= OPC_GENERIC) {
+            return NULL;
+        }
+        switch (ir->opc) {
+        case OPC_REPEAT:
+        case OPC_RDFAST:
+        case OPC_WRFAST:
+        case OPC_RFBYTE:
+        case OPC_RFWORD:
+        case OPC_RFLONG:
+        case OPC_WFBYTE:
+        case OPC_WFWORD:
+        case OPC_WFLONG:
+            return NULL;
+        default:
+            break;
+        }
+        if (IsReadWrite(ir)) {
+            if (access) return NULL;
+            access = ir;
+        }
+    }
+    if (!access || access->cond != COND_TRUE || access->srceffect != OPEFFECT_NONE) {
+        return NULL;
+    }
+    switch (access->opc) {
+    case OPC_RDBYTE: size = 1; fifo_opc = OPC_RDFAST; opc = OPC_RFBYTE; break;
+    case OPC_RDWORD: size = 2; fifo_opc = OPC_RDFAST; opc = OPC_RFWORD; break;
+    case OPC_RDLONG: size = 4; fifo_opc = OPC_RDFAST; opc = OPC_RFLONG; break;
+    case OPC_WRBYTE: size = 1; fifo_opc = OPC_WRFAST; opc = OPC_WFBYTE; break;
+    case OPC_WRWORD: size = 2; fifo_opc = OPC_WRFAST; opc = OPC_WFWORD; break;
+    case OPC_WRLONG: size = 4; fifo_opc = OPC_WRFAST; opc = OPC_WFLONG; break;
+    default:
+        return NULL;
+    }
+    if (fifo_opc == OPC_WRFAST && !allowWrite) {
+        return NULL;
+    }
+    ptr = access->src;
+    if (ptr == access->dst && fifo_opc == OPC_RDFAST) {
+        // look through a copy of the pointer:
+        //   mov t, ptr; rdbyte t, t
+        copy = access->prev;
+        while (copy && IsDummy(copy)) {
+            copy = copy->prev;
+        }
+        if (copy == root || copy->opc != OPC_MOV || copy->dst != ptr
+            || copy->cond != COND_TRUE || InstrSetsAnyFlags(copy))
+        {
+            return NULL;
+        }
+        ptr = copy->src;
+    } else {
+        copy = NULL;
     }
-    if (NeverInline(f)) {
-        return false;
+    switch (ptr->kind) {
+    case REG_LOCAL:
+    case REG_TEMP:
+    case REG_ARG:
+    case REG_REG:
+        break;
+    default:
+        return NULL;
     }
-    for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+    if (access->dst == ptr) {
+        return NULL;
+    }
+    // the pointer must be advanced exactly once, after the access, and
+    // nothing may branch away between the access and the advance
+    for (ir = access->next; ir != endjmp; ir = ir->next) {
         if (IsDummy(ir)) continue;
-        // we have to re-label any labels and branches
-        if (IsLabel(ir)) {
-            if (!ir->aux) {
-                // cannot find a unique jump going to this label
-                return false;
-            }
-            if (!IsTemporaryLabel(ir->dst)) {
-                return false;
-            }
-            continue; // do not count labels against the cost
-        } else if (IsJump(ir)) {
-            if (!ir->aux) {
-                // cannot find where this jump goes
-                return false;
-            }
-            if (!IsTemporaryLabel( ((IR *)ir->aux)->dst )) {
-                return false;
+        if (InstrModifies(ir, ptr)) {
+            if (ir->opc != OPC_ADD || ir->cond != COND_TRUE || !IsImmediateVal(ir->src, size)) {
+                return NULL;
             }
+            incr = ir;
+            break;
+        }
+        if (IsJump(ir)) {
+            return NULL;
         }
-        
-        n++;
     }
-    // a function called from only 1 place should be inlined
-    // if it means that the function definition can be eliminated
-    if (RemoveIfInlined(f) && (gl_optimize_flags & OPT_INLINE_SINGLEUSE)) {
-        if (f->callSites == 1) {
-            return true;
-        } else if (f->callSites == 2) {
-            return (n <= 2*INLINE_THRESHOLD);
+    if (!incr || InstrModifies(endjmp, ptr)) {
+        return NULL;
+    }
+    for (ir = root->next; ir != endjmp; ir = ir->next) {
+        if (ir != incr && !IsDummy(ir) && InstrModifies(ir, ptr)) {
+            return NULL;
         }
     }
 
-    // otherwise only inline small functions
-    return (n <= INLINE_THRESHOLD);
-}
-
-//
-// expand function calls inline if appropriate
-// returns 1 if anything was expanded
-int
-ExpandInlines(IRList *irl)
-{
-    Function *f;
-    IR *ir, *ir_next;
-    int change = 0;
-    
-    ir = irl->head;
-    while (ir) {
-        ir_next = ir->next;
-        if (ir->opc == OPC_CALL) {
-            f = (Function *)ir->aux;
-            if (f && FuncData(f)->isInline) {
-                ReplaceIRWithInline(irl, ir, f);
-                change = 1;
-            }
-        }
-        ir = ir_next;
+    fifo = NewIR(fifo_opc);
+    fifo->dst = NewImmediate(0);
+    fifo->src = ptr;
+    access->src = NULL;
+    ReplaceOpcode(access, opc);
+    if (copy) {
+        DeleteIR(irl, copy);
     }
-    return change;
+    return fifo;
 }
 
 //
@@ -3006,6 +4108,10 @@ LoopCanBeFcached(IRList *irl, IR *root)
         // this loop is not in HUB memory
         return false;
     }
+    if (ir->flags & FLAG_NO_FCACHE) {
+        // the profile says loading it would cost more than it saves
+        return false;
+    }
     endjmp = ir->aux;
     if (!endjmp || !IsJump(endjmp)) {
         // we don't know who jumps here
@@ -3026,6 +4132,12 @@ LoopCanBeFcached(IRList *irl, IR *root)
                 if (MaybeHubDest(ir->dst)) {
                     return false;
                 }
+                // with --lmm=lru the loop shares the FCACHE area with the
+                // cache, so a COG function which went on to run hub code
+                // could overwrite it
+                if (gl_lmm_kind == LMM_KIND_LRU) {
+                    return false;
+                }
             }
             if (IsJump(ir)) {
                 if (!JumpIsAfterOrEqual(root, ir))
@@ -3045,6 +4157,73 @@ LoopCanBeFcached(IRList *irl, IR *root)
     return true;
 }
 
+//
+// use the FIFO in loops which run from COG memory; the code after such
+// a loop may read hub memory directly, so only loops which read through
+// the FIFO are changed
+//
+void
+OptimizeCogFifo(IRList *irl)
+{
+    IR *ir;
+    IR *fifo;
+    IR *loopstart;
+
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (!IsLabel(ir) || ir->fcache || MaybeHubDest(ir->dst)) {
+            continue;
+        }
+        fifo = MakeFifoLoop(irl, ir, false);
+        if (fifo) {
+            loopstart = ir->prev;
+            while (loopstart && IsDummy(loopstart)) {
+                loopstart = loopstart->prev;
+            }
+            if (loopstart && loopstart->opc == OPC_REPEAT) {
+                loopstart = loopstart->prev;
+            }
+            InsertAfterIR(irl, loopstart, fifo);
+        }
+    }
+}
+
+//
+// with --lmm=lru, find the start of the straight line code leading up
+// to a loop which will be FCACHEd; moving it into FCACHE too means a
+// cache miss cannot come between setting up a timing loop (reading cnt,
+// for example) and running it
+//
+static IR *
+LruFcacheStart(IR *loopstart, IR *root)
+{
+    IR *ir;
+    IR *jmp = (IR *)root->aux;
+    int size = 0;
+
+    for (ir = root; ir != jmp; ir = ir->next) {
+        if (!IsDummy(ir) && !IsLabel(ir)) {
+            size++;
+        }
+    }
+    while (loopstart) {
+        if (IsDummy(loopstart)) {
+            loopstart = loopstart->prev;
+            continue;
+        }
+        if (loopstart->opc >= OPC_GENERIC || IsBranch(loopstart)
+            || loopstart->opc == OPC_RET || loopstart->fcache)
+        {
+            break;
+        }
+        if (size + 1 >= gl_fcache_size) {
+            break;
+        }
+        size++;
+        loopstart = loopstart->prev;
+    }
+    return loopstart;
+}
+
 void
 OptimizeFcache(IRList *irl)
 {
@@ -3061,17 +4240,43 @@ OptimizeFcache(IRList *irl)
                 IR *fcache = NewIR(OPC_FCACHE);
                 IR *jmp = (IR *)ir->aux;
                 IR *loopstart = ir->prev;
+                IR *fifo = NULL;
+                IR *preheader = NULL;
                 fcache->src = src;
                 fcache->dst = dst;
                 endlabel->dst = dst;
                 while (loopstart && IsDummy(loopstart)) {
                     loopstart = loopstart->prev;
                 }
-                if (loopstart && loopstart->opc == OPC_REPEAT) {
-                    loopstart = loopstart->prev;
+                if (gl_p2 && (gl_optimize_flags & OPT_HUB_FIFO)) {
+                    // the FIFO is free while running from LUT, and the
+                    // return to hub execution waits for any writes
+                    fifo = MakeFifoLoop(irl, ir, true);
+                }
+                if (gl_lmm_kind == LMM_KIND_LRU) {
+                    preheader = LruFcacheStart(loopstart, ir);
+                    if (preheader == loopstart) {
+                        preheader = NULL;
+                    }
+                }
+                if ((loopstart && loopstart->opc == OPC_REPEAT) || fifo || preheader) {
+                    if (preheader) {
+                        loopstart = preheader;
+                    } else if (loopstart && loopstart->opc == OPC_REPEAT) {
+                        loopstart = loopstart->prev;
+                    }
+                    // a NULL loopstart means the loop is at the start
+                    // of the list, and InsertAfterIR puts these first
                     startlabel = NewIR(OPC_LABEL);
                     fcache->src = startlabel->dst = NewHubLabel();
                     InsertAfterIR(irl, loopstart, startlabel);
+                    if (fifo) {
+                        InsertAfterIR(irl, startlabel, fifo);
+                    }
+                    if (preheader) {
+                        // P1 jumps in FCACHE are relative to its start
+                        src = fcache->src;
+                    }
                     ir = startlabel;
                 }
                 InsertAfterIR(irl, jmp, endlabel);
@@ -3085,3 +4290,439 @@ OptimizeFcache(IRList *irl)
         ir = ir->next;
     }
 }
+
+//
+// register allocation for local variables and temporaries
+//
+// Each local register in a function is assigned a physical register
+// based on its live range: two locals which are never live at the
+// same time can share a register. Values which must survive across
+// a call go into the "localNN" registers (which a non-leaf function
+// saves and restores); everything else goes into the "_varNN"
+// registers shared with leaf functions, which are never saved.
+//
+
+typedef uint32_t LiveWord;
+#define LIVE_BITS 32
+#define LiveTest(set, n) (((set)[(n) / LIVE_BITS] >> ((n) % LIVE_BITS)) & 1)
+#define LiveSet(set, n) ((set)[(n) / LIVE_BITS] |= (1U << ((n) % LIVE_BITS)))
+
+typedef struct LocalRegInfo {
+    Operand *op;         // the original register
+    int firstuse;        // index of first instruction referencing it
+    int color;           // register number assigned, or -1
+    bool crossesCall;    // true if live across a function call
+    Operand *movepartner; // other register this is copied to/from
+} LocalRegInfo;
+
+typedef struct RegAllocState {
+    IR **code;           // instructions, in order
+    int ncode;
+    LocalRegInfo *locals;
+    int nlocals;
+    int nwords;          // number of LiveWords in a set of locals
+    int *labels;         // indices of labels in code
+    int nlabels;
+    LiveWord *livein;    // live-in sets for each instruction
+} RegAllocState;
+
+static int
+LocalRegIndex(RegAllocState *S, Operand *op)
+{
+    int i;
+    if (!op || !IsLocal(op)) {
+        return -1;
+    }
+    for (i = 0; i < S->nlocals; i++) {
+        if (S->locals[i].op == op) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void
+AddLocalReg(RegAllocState *S, Operand *op, int idx)
+{
+    if (!op || !IsLocal(op) || LocalRegIndex(S, op) >= 0) {
+        return;
+    }
+    S->locals = (LocalRegInfo *)realloc(S->locals, (S->nlocals+1) * sizeof(LocalRegInfo));
+    memset(&S->locals[S->nlocals], 0, sizeof(LocalRegInfo));
+    S->locals[S->nlocals].op = op;
+    S->locals[S->nlocals].firstuse = idx;
+    S->locals[S->nlocals].color = -1;
+    S->nlocals++;
+}
+
+//
+// returns true if op refers to a local register in some way other than
+// as a plain register (e.g. its cog address is taken); in that case
+// we cannot safely move the local around
+//
+static bool
+IndirectLocalRef(RegAllocState *S, Operand *op)
+{
+    int i;
+    if (!op) return false;
+    switch (op->kind) {
+    case HUBMEM_REF:
+    case COGMEM_REF:
+        return LocalRegIndex(S, (Operand *)op->name) >= 0;
+    case IMM_COG_LABEL:
+        for (i = 0; i < S->nlocals; i++) {
+            if (!strcmp(S->locals[i].op->name, op->name)) {
+                return true;
+            }
+        }
+        return false;
+    default:
+        return false;
+    }
+}
+
+//
+// find the uses and definitions of local registers for instruction ir
+// "kill" is set to the local which is completely overwritten
+// (if any); "defs" includes it, and any local which is partially or
+// conditionally modified
+//
+static void
+LocalUseDef(RegAllocState *S, IR *ir, int *uses, int *defs, int *kill)
+{
+    int dst, src;
+    uses[0] = uses[1] = defs[0] = defs[1] = *kill = -1;
+    if (IsDummy(ir) || IsLabel(ir)) {
+        return;
+    }
+    dst = LocalRegIndex(S, ir->dst);
+    src = LocalRegIndex(S, ir->src);
+    uses[1] = src;
+    if (ir->opc == OPC_LIVE || ir->opc >= OPC_GENERIC) {
+        // we don't know what these do, assume they read and modify dst
+        uses[0] = defs[0] = dst;
+        return;
+    }
+    if (src >= 0 && OPEFFECT_NONE != (ir->srceffect & 0xff)) {
+        defs[1] = src;
+    }
+    if (dst < 0) {
+        return;
+    }
+    if (InstrReadsDst(ir)) {
+        uses[0] = dst;
+    }
+    if (InstrSetsDst(ir)) {
+        defs[0] = dst;
+        if (uses[0] < 0 && ir->cond == COND_TRUE) {
+            *kill = dst;
+        }
+    }
+}
+
+static int
+FindLabelIndex(RegAllocState *S, Operand *dst)
+{
+    int i;
+    IR *ir;
+    for (i = 0; i < S->nlabels; i++) {
+        ir = S->code[S->labels[i]];
+        if (ir->dst == dst || (dst->name && ir->dst->name && !strcmp(ir->dst->name, dst->name))) {
+            return S->labels[i];
+        }
+    }
+    return -1;
+}
+
+//
+// find the successors of instruction i; returns the count
+// succ must have room for nlabels+2 entries
+// a successor of -1 means "all labels" (we do not know where
+// the branch goes)
+//
+static int
+InstrSuccessors(RegAllocState *S, int i, int *succ)
+{
+    IR *ir = S->code[i];
+    int n = 0;
+    int target;
+    bool fallthrough = true;
+    Operand *dst;
+    
+    if (IsDummy(ir) || IsLabel(ir)) {
+        /* just fall through */
+    } else if (ir->opc == OPC_RET) {
+        fallthrough = (ir->cond != COND_TRUE);
+    } else if (IsJump(ir)) {
+        dst = JumpDest(ir);
+        if (ir->opc == OPC_JUMP && ir->cond == COND_TRUE) {
+            fallthrough = false;
+        }
+        if (ir->opc == OPC_JMPREL || ir->opc == OPC_GENERIC_BRANCH || !dst) {
+            target = -1;
+        } else if (curfunc && (dst == FuncData(curfunc)->asmretname)) {
+            target = -2; // function exit
+        } else {
+            target = FindLabelIndex(S, dst);
+        }
+        if (target == -1) {
+            int j;
+            for (j = 0; j < S->nlabels; j++) {
+                succ[n++] = S->labels[j];
+            }
+        } else if (target >= 0) {
+            succ[n++] = target;
+        }
+    }
+    if (fallthrough && i+1 < S->ncode) {
+        succ[n++] = i+1;
+    }
+    return n;
+}
+
+static bool
+ComputeLiveness(RegAllocState *S)
+{
+    int i, j, k, n;
+    int *succ = (int *)malloc(sizeof(int) * (S->nlabels + 2));
+    LiveWord *out = (LiveWord *)calloc(S->nwords, sizeof(LiveWord));
+    LiveWord *in;
+    LiveWord newval;
+    int uses[2], defs[2], kill;
+    bool change;
+
+    S->livein = (LiveWord *)calloc(S->ncode * S->nwords, sizeof(LiveWord));
+    do {
+        change = false;
+        for (i = S->ncode-1; i >= 0; --i) {
+            n = InstrSuccessors(S, i, succ);
+            memset(out, 0, S->nwords * sizeof(LiveWord));
+            for (j = 0; j < n; j++) {
+                in = &S->livein[succ[j] * S->nwords];
+                for (k = 0; k < S->nwords; k++) {
+                    out[k] |= in[k];
+                }
+            }
+            LocalUseDef(S, S->code[i], uses, defs, &kill);
+            if (kill >= 0) {
+                out[kill / LIVE_BITS] &= ~(1U << (kill % LIVE_BITS));
+            }
+            for (j = 0; j < 2; j++) {
+                if (uses[j] >= 0) {
+                    LiveSet(out, uses[j]);
+                }
+            }
+            in = &S->livein[i * S->nwords];
+            for (k = 0; k < S->nwords; k++) {
+                newval = out[k];
+                if (newval != in[k]) {
+                    in[k] = newval;
+                    change = true;
+                }
+            }
+        }
+    } while (change);
+    free(out);
+    free(succ);
+    return true;
+}
+
+static bool
+IsMulDivCall(IR *ir)
+{
+    Operand *dst = ir->dst;
+    return dst && (dst == mulfunc || dst == unsmulfunc || dst == divfunc || dst == unsdivfunc);
+}
+
+//
+// build the interference graph; returns a (nlocals x nlocals) bit matrix
+//
+static LiveWord *
+BuildInterference(RegAllocState *S)
+{
+    int i, j, k, v, n;
+    int *succ = (int *)malloc(sizeof(int) * (S->nlabels + 2));
+    LiveWord *out = (LiveWord *)calloc(S->nwords, sizeof(LiveWord));
+    LiveWord *graph = (LiveWord *)calloc(S->nlocals * S->nwords, sizeof(LiveWord));
+    LiveWord *in;
+    int uses[2], defs[2], kill;
+    int movesrc;
+    IR *ir;
+    
+    for (i = 0; i < S->ncode; i++) {
+        ir = S->code[i];
+        n = InstrSuccessors(S, i, succ);
+        memset(out, 0, S->nwords * sizeof(LiveWord));
+        for (j = 0; j < n; j++) {
+            in = &S->livein[succ[j] * S->nwords];
+            for (k = 0; k < S->nwords; k++) {
+                out[k] |= in[k];
+            }
+        }
+        if ( (ir->opc == OPC_CALL && !IsMulDivCall(ir)) || ir->opc == OPC_GENERIC_BRANCH) {
+            for (v = 0; v < S->nlocals; v++) {
+                if (LiveTest(out, v)) {
+                    S->locals[v].crossesCall = true;
+                }
+            }
+        }
+        LocalUseDef(S, ir, uses, defs, &kill);
+        movesrc = -1;
+        if (ir->opc == OPC_MOV && kill >= 0) {
+            movesrc = LocalRegIndex(S, ir->src);
+            if (movesrc >= 0) {
+                S->locals[kill].movepartner = S->locals[movesrc].op;
+                S->locals[movesrc].movepartner = S->locals[kill].op;
+            }
+        }
+        for (j = 0; j < 2; j++) {
+            int d = defs[j];
+            if (d < 0) continue;
+            for (v = 0; v < S->nlocals; v++) {
+                if (v == d || v == movesrc) continue;
+                if (LiveTest(out, v)) {
+                    LiveSet(&graph[d * S->nwords], v);
+                    LiveSet(&graph[v * S->nwords], d);
+                }
+            }
+        }
+    }
+    free(out);
+    free(succ);
+    return graph;
+}
+
+static int
+CompareFirstUse(const void *a, const void *b)
+{
+    const LocalRegInfo *A = *(const LocalRegInfo **)a;
+    const LocalRegInfo *B = *(const LocalRegInfo **)b;
+    return A->firstuse - B->firstuse;
+}
+
+//
+// allocate registers for the locals in irl
+// returns the number of "localNN" registers (the ones which must be
+// saved) that were used, or -1 if allocation could not be done (in
+// which case the IR is unchanged)
+// if isLeaf is set then all locals go into the leaf registers
+//
+int
+AllocateLocalRegs(IRList *irl, int isLeaf)
+{
+    RegAllocState S;
+    IR *ir, *irnext;
+    int i, j, c, n;
+    int maxsaved = 0;
+    LiveWord *graph;
+    LocalRegInfo **order;
+    bool *taken;
+    bool useLeafRegs = isLeaf || gl_compress == 0;
+
+    memset(&S, 0, sizeof(S));
+    for (ir = irl->head; ir; ir = ir->next) {
+        S.ncode++;
+    }
+    if (S.ncode == 0) {
+        return 0;
+    }
+    S.code = (IR **)malloc(S.ncode * sizeof(IR *));
+    S.labels = (int *)malloc(S.ncode * sizeof(int));
+    for (i = 0, ir = irl->head; ir; ir = ir->next, i++) {
+        S.code[i] = ir;
+        if (IsLabel(ir)) {
+            S.labels[S.nlabels++] = i;
+        } else if (!IsDummy(ir)) {
+            AddLocalReg(&S, ir->dst, i);
+            AddLocalReg(&S, ir->src, i);
+        }
+    }
+    // check for locals used in ways we do not understand
+    for (i = 0; i < S.ncode; i++) {
+        ir = S.code[i];
+        if (IsDummy(ir)) continue;
+        if (IndirectLocalRef(&S, ir->dst) || IndirectLocalRef(&S, ir->src)
+            || (ir->src2 && IsLocal(ir->src2)))
+        {
+            n = -1;
+            goto done;
+        }
+    }
+    S.nwords = (S.nlocals + LIVE_BITS - 1) / LIVE_BITS;
+    if (S.nwords == 0) S.nwords = 1;
+    
+    ComputeLiveness(&S);
+    graph = BuildInterference(&S);
+
+    // color in order of first appearance; this keeps the numbering
+    // close to what a simple scan of the code would give
+    order = (LocalRegInfo **)malloc(S.nlocals * sizeof(LocalRegInfo *));
+    for (i = 0; i < S.nlocals; i++) {
+        order[i] = &S.locals[i];
+    }
+    qsort(order, S.nlocals, sizeof(*order), CompareFirstUse);
+    taken = (bool *)malloc((S.nlocals + 1) * sizeof(bool));
+    for (i = 0; i < S.nlocals; i++) {
+        LocalRegInfo *L = order[i];
+        int idx = L - S.locals;
+        bool saved = !isLeaf && (L->crossesCall || !useLeafRegs);
+        memset(taken, 0, (S.nlocals + 1) * sizeof(bool));
+        for (j = 0; j < S.nlocals; j++) {
+            LocalRegInfo *M = &S.locals[j];
+            bool msaved = !isLeaf && (M->crossesCall || !useLeafRegs);
+            if (M->color >= 0 && msaved == saved && LiveTest(&graph[idx * S.nwords], j)) {
+                taken[M->color] = true;
+            }
+        }
+        c = -1;
+        if (L->movepartner) {
+            // try to use the same register as the other side of a move
+            j = LocalRegIndex(&S, L->movepartner);
+            if (j >= 0) {
+                LocalRegInfo *M = &S.locals[j];
+                bool msaved = !isLeaf && (M->crossesCall || !useLeafRegs);
+                if (M->color >= 0 && msaved == saved && !taken[M->color]) {
+                    c = M->color;
+                }
+            }
+        }
+        if (c < 0) {
+            for (c = 0; taken[c]; c++)
+                ;
+        }
+        L->color = c;
+        if (saved && c+1 > maxsaved) {
+            maxsaved = c+1;
+        }
+    }
+    free(taken);
+    free(order);
+    free(graph);
+    free(S.livein);
+    
+    // now rename the registers
+    for (i = 0; i < S.nlocals; i++) {
+        LocalRegInfo *L = &S.locals[i];
+        bool saved = !isLeaf && (L->crossesCall || !useLeafRegs);
+        Operand *replace = GetLocalReg(L->color, !saved);
+        for (j = 0; j < S.ncode; j++) {
+            ir = S.code[j];
+            if (ir->dst == L->op) ir->dst = replace;
+            if (ir->src == L->op) ir->src = replace;
+        }
+        L->op->used = 0;
+    }
+    // and remove any moves that have become redundant
+    for (ir = irl->head; ir; ir = irnext) {
+        irnext = ir->next;
+        if (ir->opc == OPC_MOV && ir->dst == ir->src && !InstrSetsAnyFlags(ir) && !InstrIsVolatile(ir)) {
+            DeleteIR(irl, ir);
+        }
+    }
+    n = maxsaved;
+done:
+    free(S.locals);
+    free(S.labels);
+    free(S.code);
+    return n;
+}
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <ctype.h>
+#include <math.h>
 #include "spinc.h"
 #include "outasm.h"
 
@@ -50,6 +51,7 @@ static int max_coginit_args = 4;
 /* operands for multiply/divide */
 Operand *mulfunc, *unsmulfunc, *muldiva, *muldivb;
 Operand *divfunc, *unsdivfunc;
+static Operand *fracfunc;
 
 Operand *putcogreg;
 
@@ -84,11 +86,17 @@ static Operand *linkreg;
 Operand *heapptr;
 static Operand *heaplabel;
 
+Operand *dataptr;
+static Operand *datalabel;
+
 static Operand *hubexit;
 static Operand *cogexit;
 
 static Operand *kernelptr;
 
+// string() literals in Spin code, which must not share memory
+static OperandList *writableStrings;
+
 static Operand *CompileExpression(IRList *irl, AST *expr, Operand *dest);
 static Operand* CompileMul(IRList *irl, AST *expr, int gethi, Operand *dest);
 static Operand* CompileDiv(IRList *irl, AST *expr, int getmod, Operand *dest);
@@ -208,7 +216,6 @@ IdentifierModuleName(Module *P, const char *name)
     return strdup(temp);
 }
 
-Operand *GetLocalReg(int n, int isLeaf); // forward declaration
 
 static bool
 PutVarOnStack(Function *func, Symbol *sym, int size)
@@ -248,6 +255,17 @@ ValidateHeapptr(void)
     heapptr = NewImmediatePtr("__heap_ptr", heaplabel);
 }
 
+/* pointer to the start of the hub data (used by the garbage collector) */
+void
+ValidateDataptr(void)
+{
+    if (dataptr) {
+        return;
+    }
+    datalabel = NewOperand(IMM_HUB_LABEL, "__data_start", 0);
+    dataptr = NewImmediatePtr("__data_ptr", datalabel);
+}
+
 void
 ValidateStackptr(void)
 {
@@ -1492,6 +1510,13 @@ RenameLocalRegs(IRList *irl, int isLeaf)
     Operand *replace = NULL;
     int numlocals = 0;
 
+    if (gl_optimize_flags & OPT_BASIC_ASM) {
+        numlocals = AllocateLocalRegs(irl, isLeaf);
+        if (numlocals >= 0) {
+            return numlocals;
+        }
+        numlocals = 0;
+    }
     for (ir = irl->head; ir; ir = ir->next) {
         if (IsDummy(ir)) continue;
         if (ir->dst && IsLocal(ir->dst)) {
@@ -1547,6 +1572,22 @@ NeedFramePointer(Function *func)
     return FRAME_NO;
 }
 
+//
+// rough number of instructions spent on the frame in each call to func
+//
+int
+FrameSetupCost(Function *func)
+{
+    switch (NeedFramePointer(func)) {
+    case FRAME_YES:
+        return 4;
+    case FRAME_MAYBE:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
 //
 // the header/footer are code that should only be emitted for
 // non-inline function invocations, at the beginning and
@@ -1561,6 +1602,11 @@ static void EmitFunctionHeader(IRList *irl, Function *func)
     // earlier we put the appropriate comments into func->irheader
     // copy them out now
     AppendIRList(irl, &FuncData(func)->irheader);
+    if (gl_srccomments && FuncData(func)->hubClocksSaved > 0) {
+        char buf[80];
+        sprintf(buf, "hub access scheduling saved about %d clocks", FuncData(func)->hubClocksSaved);
+        EmitOp1(irl, OPC_COMMENT, NewOperand(IMM_STRING, strdup(buf), 0));
+    }
 
     if (gl_output == OUTPUT_COGSPIN && FuncData(func)->asmaltname) {
         // insert a dummy function header that just changes the return address
@@ -1741,18 +1787,201 @@ static int DecomposeBits(unsigned val, int *shifts)
 
 static int g_NeedMulHi = 0;
 
+//
+// range of values an expression may have
+//
+typedef struct ValueRange {
+    int32_t lo;
+    int32_t hi;
+} ValueRange;
+
+static bool
+InRange(const ValueRange *r, int32_t lo, int32_t hi)
+{
+    return r->lo >= lo && r->hi <= hi;
+}
+
+static uint32_t
+RangeMagnitude(const ValueRange *r)
+{
+    uint32_t lo = (r->lo < 0) ? -(uint32_t)r->lo : r->lo;
+    uint32_t hi = (r->hi < 0) ? -(uint32_t)r->hi : r->hi;
+    return (lo > hi) ? lo : hi;
+}
+
+//
+// ranges of the values of common subexpression temporaries in
+// the current function; each of these is only ever assigned the
+// same expression, so its range is the range of that expression
+//
+typedef struct TempRange {
+    struct TempRange *next;
+    Function *func;
+    const char *name;
+    ValueRange r;
+} TempRange;
+
+static TempRange *cse_ranges;
+
+static void ExprRange(AST *expr, ValueRange *r);
+
+static void
+NoteAssignRange(AST *lhs, AST *rhs)
+{
+    TempRange *t;
+
+    if (!lhs || lhs->kind != AST_IDENTIFIER || strncmp(lhs->d.string, "_cse_", 5) != 0) {
+        return;
+    }
+    for (t = cse_ranges; t; t = t->next) {
+        if (t->func == curfunc && !strcmp(t->name, lhs->d.string)) {
+            return;
+        }
+    }
+    t = (TempRange *)calloc(1, sizeof(*t));
+    t->func = curfunc;
+    t->name = lhs->d.string;
+    ExprRange(rhs, &t->r);
+    t->next = cse_ranges;
+    cse_ranges = t;
+}
+
+//
+// find the range of values an expression may produce, based on
+// constants, masks, shifts, and the sizes of integer types
+//
+static void
+ExprRange(AST *expr, ValueRange *r)
+{
+    ValueRange a, b;
+    AST *type;
+    int n;
+
+    r->lo = INT32_MIN;
+    r->hi = INT32_MAX;
+    if (!expr) {
+        return;
+    }
+    if (IsConstExpr(expr)) {
+        r->lo = r->hi = EvalConstExpr(expr);
+        return;
+    }
+    if (expr->kind == AST_IDENTIFIER) {
+        TempRange *t;
+        for (t = cse_ranges; t; t = t->next) {
+            if (t->func == curfunc && !strcmp(t->name, expr->d.string)) {
+                *r = t->r;
+                return;
+            }
+        }
+    }
+    if (expr->kind == AST_OPERATOR) {
+        switch (expr->d.ival) {
+        case '&':
+            ExprRange(expr->left, &a);
+            ExprRange(expr->right, &b);
+            if (a.lo >= 0 && b.lo >= 0) {
+                r->lo = 0;
+                r->hi = (a.hi < b.hi) ? a.hi : b.hi;
+            } else if (a.lo >= 0) {
+                *r = a;
+                r->lo = 0;
+            } else if (b.lo >= 0) {
+                *r = b;
+                r->lo = 0;
+            }
+            return;
+        case K_SHR:
+        case K_SAR:
+            if (!IsConstExpr(expr->right)) {
+                return;
+            }
+            n = EvalConstExpr(expr->right) & 31;
+            ExprRange(expr->left, &a);
+            if (a.lo >= 0 || expr->d.ival == K_SAR) {
+                r->lo = a.lo >> n;
+                r->hi = a.hi >> n;
+            } else if (n > 0) {
+                r->lo = 0;
+                r->hi = (int32_t)(0xffffffffU >> n);
+            }
+            return;
+        case K_ZEROEXTEND:
+        case K_SIGNEXTEND:
+            if (!IsConstExpr(expr->right)) {
+                return;
+            }
+            n = EvalConstExpr(expr->right);
+            if (n <= 0 || n >= 32) {
+                return;
+            }
+            if (expr->d.ival == K_ZEROEXTEND) {
+                r->lo = 0;
+                r->hi = (1 << n) - 1;
+            } else {
+                r->lo = -(1 << (n-1));
+                r->hi = (1 << (n-1)) - 1;
+            }
+            return;
+        default:
+            break;
+        }
+    }
+    // only a plain load is known to fit in its type; arithmetic on
+    // small values can produce results which do not
+    switch (expr->kind) {
+    case AST_IDENTIFIER:
+    case AST_LOCAL_IDENTIFIER:
+    case AST_SYMBOL:
+    case AST_MEMREF:
+    case AST_ARRAYREF:
+        break;
+    default:
+        return;
+    }
+    type = ExprType(expr);
+    if (type && IsIntType(type)) {
+        n = TypeSize(type) * 8;
+        if (n < 32) {
+            // a small signed value may not have been sign extended yet
+            // (that is done by an explicit K_SIGNEXTEND), so allow for
+            // either form
+            r->lo = IsUnsignedType(type) ? 0 : -(1 << (n-1));
+            r->hi = (1 << n) - 1;
+        }
+    }
+}
+
 static Operand *
-doCompileMul(IRList *irl, Operand *lhs, Operand *rhs, int gethi, Operand *dest)
+doCompileMul(IRList *irl, Operand *lhs, Operand *rhs, int gethi, Operand *dest,
+             const ValueRange *lrange, const ValueRange *rrange)
 {    
     Operand *temp = NewFunctionTempRegister();
     int isUnsigned = (gethi & 2);
+    ValueRange lr, rr;
     g_NeedMulHi |= (gethi & 1);
-    
+
+    if (lrange && rrange) {
+        lr = *lrange;
+        rr = *rrange;
+    } else {
+        lr.lo = rr.lo = INT32_MIN;
+        lr.hi = rr.hi = INT32_MAX;
+    }
+    if (lhs->kind == IMM_INT) {
+        lr.lo = lr.hi = lhs->val;
+    }
+    if (rhs->kind == IMM_INT) {
+        rr.lo = rr.hi = rhs->val;
+    }
     // if lhs is constant, swap left and right
     if (lhs->kind == IMM_INT) {
         Operand *swap = lhs;
+        ValueRange rswap = lr;
         lhs = rhs;
         rhs = swap;
+        lr = rr;
+        rr = rswap;
     }
     // check for multiply by constants
     if (rhs->kind == IMM_INT && rhs->val >= 0 && gethi == 0) {
@@ -1786,6 +2015,77 @@ doCompileMul(IRList *irl, Operand *lhs, Operand *rhs, int gethi, Operand *dest)
             return temp;
         }
     }
+    if (gethi == 0 && gl_p2) {
+        // products of 16 bit values can use the hardware multiplier
+        IROpcode opc = OPC_UNKNOWN;
+        if (InRange(&lr, 0, 0xffff) && InRange(&rr, 0, 0xffff)) {
+            opc = OPC_MUL;
+        } else if (InRange(&lr, -0x8000, 0x7fff) && InRange(&rr, -0x8000, 0x7fff)) {
+            opc = OPC_MULS;
+        }
+        if (opc != OPC_UNKNOWN) {
+            lhs = Dereference(irl, lhs);
+            rhs = Dereference(irl, rhs);
+            EmitMove(irl, temp, lhs);
+            EmitOp2(irl, opc, temp, rhs);
+            return temp;
+        }
+    }
+    if (gethi == 0 && !gl_p2) {
+        // the low 32 bits of the product do not depend on the signs;
+        // the multiply loop runs once for each bit of muldivb_, so
+        // put the smaller operand there, and skip the sign handling
+        // if it cannot be negative
+        if (RangeMagnitude(&lr) < RangeMagnitude(&rr)) {
+            Operand *swap = lhs;
+            ValueRange rswap = lr;
+            lhs = rhs;
+            rhs = swap;
+            lr = rr;
+            rr = rswap;
+        }
+        if (rr.lo >= 0) {
+            isUnsigned = 1;
+        }
+    }
+    if (gl_p2) {
+        // the low 32 bits of the product are the same whether or not
+        // the operands are signed, so we can just use the CORDIC
+        // directly; this also lets independent multiplies overlap
+        //
+        // the CORDIC multiply is unsigned; for the signed high word,
+        // a negative operand was taken as 2^32 too big, which added
+        // 2^32 times the other operand to the product, so subtract
+        // the other operand from the high word for each one
+        IR *ir;
+        int fixsign = (gethi & 1) && !isUnsigned;
+        lhs = Dereference(irl, lhs);
+        rhs = Dereference(irl, rhs);
+        if (!IsRegister(lhs->kind)) {
+            Operand *ltemp = fixsign ? NewFunctionTempRegister() : temp;
+            EmitMove(irl, ltemp, lhs);
+            lhs = ltemp;
+        }
+        EmitOp2(irl, OPC_QMUL, lhs, rhs);
+        EmitOp1(irl, (gethi & 1) ? OPC_GETQY : OPC_GETQX, temp);
+        if (fixsign) {
+            ir = EmitOp2(irl, OPC_CMPS, lhs, NewImmediate(0));
+            ir->flags |= FLAG_WC;
+            ir = EmitOp2(irl, OPC_SUB, temp, rhs);
+            ir->cond = COND_LT;
+            if (rhs->kind == IMM_INT) {
+                if (rhs->val < 0) {
+                    EmitOp2(irl, OPC_SUB, temp, lhs);
+                }
+            } else {
+                ir = EmitOp2(irl, OPC_CMPS, rhs, NewImmediate(0));
+                ir->flags |= FLAG_WC;
+                ir = EmitOp2(irl, OPC_SUB, temp, lhs);
+                ir->cond = COND_LT;
+            }
+        }
+        return temp;
+    }
     if (!mulfunc) {
         mulfunc = NewOperand(IMM_COG_LABEL, "multiply_", 0);
         unsmulfunc = NewOperand(IMM_COG_LABEL, "unsmultiply_", 0);
@@ -1812,10 +2112,385 @@ CompileMul(IRList *irl, AST *expr, int gethi, Operand *dest)
 {
     Operand *lhs = CompileExpression(irl, expr->left, NULL);
     Operand *rhs = CompileExpression(irl, expr->right, NULL);
-    return doCompileMul(irl, lhs, rhs, gethi, dest);
+    ValueRange lrange, rrange;
+
+    ExprRange(expr->left, &lrange);
+    ExprRange(expr->right, &rrange);
+    return doCompileMul(irl, lhs, rhs, gethi, dest, &lrange, &rrange);
+}
+
+//
+// division by constants
+//
+// On P1 a division by a constant d can be done with a short sequence
+// of shifts and adds which approximates y = x * (2^a / d), where
+// 2^a < d < 2^(a+1), so that x / d is roughly y >> a. The
+// approximation never overshoots, and is off by only a little, so a
+// few compare and subtract steps on the remainder fix it up (see
+// Hacker's Delight, chapter 10).
+//
+// The digits of 2^a / d repeat with some period p; if p is small we
+// only need the first p digits and then can double the number of
+// digits by y += y >> p, y += y >> 2p, and so on.
+//
+#define MAX_DIVCONST_TERMS 34
+#define MAX_DIVCONST_INSTRS 40
+
+typedef struct DivConstPlan {
+    int a;                             // final shift: q = y >> a
+    int nterms;
+    int shift[MAX_DIVCONST_TERMS];     // y += sign[i] * (x >> shift[i])
+    int sign[MAX_DIVCONST_TERMS];
+    int ndoubles;
+    int doubles[5];                    // y += y >> doubles[i]
+    int bias;                          // subtracted from y so it never overshoots
+    int ncorrect;                      // number of correction steps
+} DivConstPlan;
+
+//
+// find the digits of n, either as plain binary or in non-adjacent
+// form (canonical signed digits), which has fewer non-zero digits
+// digits are placed from the most significant down
+// returns the number of non-zero digits, or -1 if there are too many
+//
+static int
+SignedDigits(uint64_t n, int nonadjacent, int *sign, int *pos, int maxdigits)
+{
+    int tsign[65], tpos[65];
+    int i = 0, count = 0;
+    int s;
+
+    while (n) {
+        if (n & 1) {
+            s = nonadjacent ? 2 - (int)(n & 3) : 1;
+            n -= s;
+            tsign[count] = s;
+            tpos[count] = i;
+            count++;
+        }
+        n >>= 1;
+        i++;
+    }
+    if (count > maxdigits) {
+        return -1;
+    }
+    for (i = 0; i < count; i++) {
+        sign[i] = tsign[count-1-i];
+        pos[i] = tpos[count-1-i];
+    }
+    return count;
+}
+
+//
+// fill in the terms of a plan to calculate y = x * digits / 2^L,
+// and work out the error bounds for it
+// returns an estimate of the number of instructions needed, or
+// -1 if it is not possible
+//
+static int
+PlanDivTerms(DivConstPlan *plan, uint64_t digits, int L, int nonadjacent)
+{
+    int sign[MAX_DIVCONST_TERMS], pos[MAX_DIVCONST_TERMS];
+    int i, n;
+    double lo, hi;
+
+    n = SignedDigits(digits, nonadjacent, sign, pos, MAX_DIVCONST_TERMS);
+    if (n < 0) {
+        return -1;
+    }
+    // each shift may lose up to 1; additions make y too small,
+    // subtractions too big
+    lo = hi = 0.0;
+    for (i = 0; i < n; i++) {
+        plan->shift[i] = L - pos[i];
+        plan->sign[i] = sign[i];
+        if (sign[i] > 0) {
+            lo += 1.0;
+        } else {
+            hi += 1.0;
+        }
+    }
+    plan->nterms = n;
+    for (i = 0; i < plan->ndoubles; i++) {
+        double scale = 1.0 + ldexp(1.0, -plan->doubles[i]);
+        lo = lo * scale + 1.0;
+        hi = hi * scale;
+    }
+    // the digits we left off could add up to almost 1
+    lo += 1.01;
+    plan->bias = (int)ceil(hi);
+    plan->ncorrect = (int)ceil( (lo + plan->bias) / ldexp(1.0, plan->a) );
+    return 2*n + (plan->bias ? 2 : 0) + 3*plan->ncorrect;
+}
+
+//
+// work out how to calculate x / d for unsigned 32 bit x
+// returns 0 if d is not suitable
+//
+static int
+PlanDivConst(uint32_t d, DivConstPlan *plan)
+{
+    int a, k, p, i, L;
+    int cost, altcost;
+    uint32_t dodd, r;
+    uint64_t digits;
+    DivConstPlan alt;
+
+    if (d < 3 || isPowerOf2(d)) {
+        return 0;
+    }
+    for (a = 0; (d >> a) > 1; a++)
+        ;
+    for (k = 0; ((d >> k) & 1) == 0; k++)
+        ;
+    dodd = d >> k;
+    // find the period of the digits of 1/dodd
+    p = 1;
+    r = 2 % dodd;
+    while (r != 1 && p < 32) {
+        r = (uint32_t)(((uint64_t)r * 2) % dodd);
+        p++;
+    }
+    memset(plan, 0, sizeof(*plan));
+    plan->a = a;
+    if (r == 1 && p < 32) {
+        // 2^a / d == digits / (2^p - 1)
+        digits = ((1ULL << (a-k)) * ((1ULL << p) - 1)) / dodd;
+        L = p;
+        for (i = p; i < 32; i *= 2) {
+            plan->doubles[plan->ndoubles++] = i;
+        }
+    } else {
+        digits = (1ULL << (a+32)) / d;
+        L = 32;
+    }
+    // use whichever of plain binary or signed digits is shorter
+    alt = *plan;
+    cost = PlanDivTerms(plan, digits, L, 0);
+    altcost = PlanDivTerms(&alt, digits, L, 1);
+    if (altcost >= 0 && (cost < 0 || altcost < cost)) {
+        *plan = alt;
+        cost = altcost;
+    }
+    if (cost < 0) {
+        return 0;
+    }
+    // make sure y cannot overflow
+    if ( 4294967295.0 * ldexp(1.0, a) / d + plan->bias >= 4294967295.0 ) {
+        return 0;
+    }
+    return 1;
+}
+
+//
+// multiply src by a constant using shifts and adds; this is used
+// only where we know the result cannot overflow
+//
+static void
+EmitMulConstShiftAdd(IRList *irl, Operand *dst, Operand *src, uint32_t val)
+{
+    int sign[33], pos[33];
+    int i, n;
+
+    n = SignedDigits(val, 1, sign, pos, 33);
+    EmitMove(irl, dst, src);
+    for (i = 1; i < n; i++) {
+        EmitOp2(irl, OPC_SHL, dst, NewImmediate(pos[i-1] - pos[i]));
+        EmitOp2(irl, sign[i] > 0 ? OPC_ADD : OPC_SUB, dst, src);
+    }
+    if (pos[n-1]) {
+        EmitOp2(irl, OPC_SHL, dst, NewImmediate(pos[n-1]));
+    }
+}
+
+//
+// emit code to calculate x / d (if getmod is 0) or x % d (if getmod
+// is 1) using shifts and adds; x is unsigned
+// returns NULL if this would take too many instructions
+//
+static Operand *
+EmitUnsDivConstP1(IRList *irl, Operand *x, uint32_t d, int getmod)
+{
+    DivConstPlan plan;
+    IRList seq;
+    IR *ir;
+    Operand *y, *t, *r;
+    Operand *dop = NewImmediate(d);
+    int i, count;
+
+    if (!PlanDivConst(d, &plan)) {
+        return NULL;
+    }
+    memset(&seq, 0, sizeof(seq));
+    y = NewFunctionTempRegister();
+    t = NewFunctionTempRegister();
+    r = NewFunctionTempRegister();
+
+    // y = sum of (x >> shift[i]); the shifts increase, so each term
+    // can be derived from the previous one
+    EmitMove(&seq, t, x);
+    for (i = 0; i < plan.nterms; i++) {
+        int shift = plan.shift[i] - (i ? plan.shift[i-1] : 0);
+        if (shift) {
+            EmitOp2(&seq, OPC_SHR, t, NewImmediate(shift));
+        }
+        if (i == 0) {
+            EmitMove(&seq, y, t);
+        } else {
+            EmitOp2(&seq, plan.sign[i] > 0 ? OPC_ADD : OPC_SUB, y, t);
+        }
+    }
+    for (i = 0; i < plan.ndoubles; i++) {
+        EmitMove(&seq, t, y);
+        EmitOp2(&seq, OPC_SHR, t, NewImmediate(plan.doubles[i]));
+        EmitOp2(&seq, OPC_ADD, y, t);
+    }
+    if (plan.bias) {
+        ir = EmitOp2(&seq, OPC_SUB, y, NewImmediate(plan.bias));
+        ir->flags |= FLAG_WC;
+        ir = EmitMove(&seq, y, NewImmediate(0));
+        ir->cond = COND_C;
+    }
+    EmitOp2(&seq, OPC_SHR, y, NewImmediate(plan.a));
+
+    // now y is the quotient, possibly a little too small; fix it up
+    EmitMulConstShiftAdd(&seq, t, y, d);
+    EmitMove(&seq, r, x);
+    EmitOp2(&seq, OPC_SUB, r, t);
+    for (i = 0; i < plan.ncorrect; i++) {
+        int last = (i == plan.ncorrect - 1);
+        ir = EmitOp2(&seq, OPC_CMP, r, dop);
+        ir->flags |= FLAG_WC;
+        if (!getmod || !last) {
+            ir = EmitOp2(&seq, OPC_ADD, y, NewImmediate(1));
+            ir->cond = COND_NC;
+        }
+        if (getmod || !last) {
+            ir = EmitOp2(&seq, OPC_SUB, r, dop);
+            ir->cond = COND_NC;
+        }
+    }
+
+    count = 0;
+    for (ir = seq.head; ir; ir = ir->next) {
+        count++;
+    }
+    if (count > MAX_DIVCONST_INSTRS) {
+        return NULL;
+    }
+    AppendIRList(irl, &seq);
+    return getmod ? r : y;
 }
 
-#define FAST_IMMEDIATE_DIVIDES
+//
+// compile a divide or remainder of lhs by a constant
+// getmod and isSigned are as for CompileDiv
+// returns NULL if we should just call the general divide routine
+//
+static Operand *
+CompileDivConst(IRList *irl, Operand *lhs, int32_t val, int getmod, int isSigned, Operand *temp)
+{
+    IR *ir;
+    uint32_t d = (uint32_t)val;
+    int negquot = 0;
+    Operand *x, *sgn = NULL;
+    Operand *result;
+    IRList seq;
+
+    if (val == 0 || lhs->kind == IMM_INT) {
+        return NULL;
+    }
+    if (isSigned && val < 0) {
+        if (val == INT32_MIN) {
+            return NULL;
+        }
+        d = -val;
+        negquot = 1;
+    }
+    if (d == 1) {
+        if (getmod) {
+            EmitMove(irl, temp, NewImmediate(0));
+        } else {
+            EmitMove(irl, temp, lhs);
+            if (negquot) {
+                EmitOp2(irl, OPC_NEG, temp, temp);
+            }
+        }
+        return temp;
+    }
+    if (!isPowerOf2(d) && !gl_p2 && (!curfunc || !curfunc->cog_code)) {
+        // on P1 the shift and add sequence is only a win if it runs
+        // from COG memory
+        return NULL;
+    }
+    if (isPowerOf2(d)) {
+        int shift = 0;
+
+        lhs = Dereference(irl, lhs);
+
+        if (isSigned) {
+            ir = EmitOp2(irl, OPC_ABS, temp, lhs);
+            ir->flags |= FLAG_WC; // carry will have the original sign bit
+        } else {
+            EmitMove(irl, temp, lhs);
+        }
+        if (getmod) {
+            EmitOp2(irl, OPC_AND, temp, NewImmediate(d-1));
+        } else {
+            while ( (d >> shift) != 1) {
+                shift++;
+            }
+            EmitOp2(irl, OPC_SHR, temp, NewImmediate(shift));
+        }
+        if (isSigned) {
+            ir = EmitOp2(irl, OPC_NEG, temp, temp);
+            // negate if x < 0, or for a quotient by a negative
+            // number if x >= 0
+            ir->cond = (negquot && !getmod) ? COND_GE : COND_LT;
+        }
+        return temp;
+    }
+    if (gl_p2) {
+        // the CORDIC does an unsigned divide in a fixed time, so just
+        // do it inline rather than calling the general routine
+        lhs = Dereference(irl, lhs);
+        x = NewFunctionTempRegister();
+        if (isSigned) {
+            ir = EmitOp2(irl, OPC_ABS, x, lhs);
+            ir->flags |= FLAG_WC;
+        } else {
+            EmitMove(irl, x, lhs);
+        }
+        EmitOp2(irl, OPC_QDIV, x, NewImmediate(d));
+        EmitOp1(irl, getmod ? OPC_GETQY : OPC_GETQX, temp);
+        if (isSigned) {
+            ir = EmitOp2(irl, OPC_NEG, temp, temp);
+            ir->cond = (negquot && !getmod) ? COND_GE : COND_LT;
+        }
+        return temp;
+    }
+    memset(&seq, 0, sizeof(seq));
+    x = lhs = Dereference(&seq, lhs);
+    if (isSigned) {
+        sgn = NewFunctionTempRegister();
+        x = NewFunctionTempRegister();
+        EmitMove(&seq, sgn, lhs);
+        EmitOp2(&seq, OPC_ABS, x, sgn);
+    }
+    result = EmitUnsDivConstP1(&seq, x, d, getmod);
+    if (!result) {
+        return NULL;
+    }
+    EmitMove(&seq, temp, result);
+    if (isSigned) {
+        ir = EmitOp2(&seq, OPC_CMPS, sgn, NewImmediate(0));
+        ir->flags |= FLAG_WC;
+        ir = EmitOp2(&seq, OPC_NEG, temp, temp);
+        ir->cond = (negquot && !getmod) ? COND_GE : COND_LT;
+    }
+    AppendIRList(irl, &seq);
+    return temp;
+}
 
 // getmod is: 0 for divide, 1 for remainder, 2 for unsigned divide, 3 for unsigned remainder
 //  special case: 4 is for unsigned 64 bit by 32 bit division
@@ -1830,45 +2505,14 @@ CompileDiv(IRList *irl, AST *expr, int getmod, Operand *dest)
   
   getmod &= 1;
   
-#ifdef FAST_IMMEDIATE_DIVIDES
-  if (rhs->kind == IMM_INT && rhs->val > 0 && isPowerOf2(rhs->val) && !isfrac64) {
-      IR *ir;
-      int val = rhs->val;
-      
-      if (val == 1) {
-          EmitMove(irl, temp, lhs);
-          return temp;
-      }
-
-      lhs = Dereference(irl, lhs);
-      if (isSigned) {
-          ir = EmitOp2(irl, OPC_ABS, temp, lhs);
-          ir->flags |= FLAG_WC; // carry will have the original sign bit
-      } else {
-          EmitMove(irl, temp, lhs);
-      }
-      if (getmod) {
-          EmitOp2(irl, OPC_AND, temp, NewImmediate(val-1));
-      } else {
-          int shift = 0;
-          val = val >>1;
-          while (val != 0) {
-              shift++;
-              val = val >> 1;
-          }
-          EmitOp2(irl, OPC_SHR, temp, NewImmediate(shift));
+  if (rhs->kind == IMM_INT && !isfrac64) {
+      Operand *result = CompileDivConst(irl, lhs, rhs->val, getmod, isSigned, temp);
+      if (result) {
+          return result;
       }
-      if (isSigned) {
-          ir = EmitOp2(irl, OPC_NEG, temp, temp);
-          ir->cond = COND_LT; // only do the negate if x < 0
-      }
-      return temp;
   }
-#endif
   
-  if (!divfunc) {
-    divfunc = NewOperand(IMM_COG_LABEL, "divide_", 0);
-    unsdivfunc = NewOperand(IMM_COG_LABEL, "unsdivide_", 0);
+  if (!muldiva) {
     muldiva = GetOneGlobal(REG_ARG, "muldiva_", 0);
     muldivb = GetOneGlobal(REG_ARG, "muldivb_", 0);
   }
@@ -1881,11 +2525,20 @@ CompileDiv(IRList *irl, AST *expr, int getmod, Operand *dest)
           EmitOp1(irl, OPC_GETQX, temp);
           return temp;
       }
-      ERROR(expr, "FRAC not supported on P1 yet");
-  } else {
+      if (!fracfunc) {
+          fracfunc = NewOperand(IMM_COG_LABEL, "frac_", 0);
+      }
       EmitMove(irl, muldiva, lhs);
       EmitMove(irl, muldivb, rhs);
-      EmitOp1(irl, OPC_CALL, (isSigned) ? divfunc : unsdivfunc);
+      EmitOp1(irl, OPC_CALL, fracfunc);
+  } else {
+      if (!divfunc) {
+          divfunc = NewOperand(IMM_COG_LABEL, "divide_", 0);
+          unsdivfunc = NewOperand(IMM_COG_LABEL, "unsdivide_", 0);
+      }
+      EmitMove(irl, muldiva, lhs);
+      EmitMove(irl, muldivb, rhs);
+      EmitOp1(irl, OPC_CALL, (isSigned) ? divfunc : unsdivfunc);
   }
   if (getmod) {
       EmitMove(irl, temp, muldiva);
@@ -2996,7 +3649,7 @@ ApplyArrayIndex(IRList *irl, Operand *base, Operand *offset, int siz)
         if (siz == 4) {
             EmitOp2(irl, OPC_SHL, temp, NewImmediate(2));
         } else {
-            Operand *temp2 = doCompileMul(irl, temp, NewImmediate(siz), 0, temp);
+            Operand *temp2 = doCompileMul(irl, temp, NewImmediate(siz), 0, temp, NULL, NULL);
             temp = temp2;
         }
     }
@@ -3618,6 +4271,7 @@ CompileExpression(IRList *irl, AST *expr, Operand *dest)
           }
       }
       EmitMove(irl, r, val);
+      NoteAssignRange(expr->left, expr->right);
       return r;
   case AST_RANGEREF:
       return CompileExpression(irl, TransformRangeUse(expr), dest);
@@ -3631,6 +4285,10 @@ CompileExpression(IRList *irl, AST *expr, Operand *dest)
       // evaluate any const references in our current context
       AST *stringExpr = EvalStringConst(expr->left);
       r = GetOneHub(STRING_DEF, NewTempLabelName(), (intptr_t)(stringExpr));
+      if (curfunc && IsSpinLang(curfunc->language)) {
+          // Spin programs may write into string() literals
+          AppendOperand(&writableStrings, r);
+      }
       if (gl_p2) {
           Operand *temp = NewFunctionTempRegister();
           EmitMove(irl, temp, r);
@@ -4077,12 +4735,26 @@ FreeTempRegisters(IRList *irl, int starttempreg)
 // Lexit
 //
 
+//
+// emit the label at the top of a loop; if the profile shows that the
+// loop usually runs only once, mark it so it is not put in FCACHE
+//
+static IR *EmitLoopLabel(IRList *irl, Operand *label, AST *loop)
+{
+    IR *ir = EmitLabel(irl, label);
+    if (ProfileFewIterations(curfunc, loop)) {
+        ir->flags |= FLAG_NO_FCACHE;
+    }
+    return ir;
+}
+
 static void CompileForLoop(IRList *irl, AST *ast, int atleastonce)
 {
     AST *initstmt;
     AST *loopcond;
     AST *update;
     AST *body = 0;
+    AST *loop = ast;
 
     Operand *toplabel, *nextlabel, *exitlabel;
     initstmt = ast->left;
@@ -4117,7 +4789,7 @@ static void CompileForLoop(IRList *irl, AST *ast, int atleastonce)
     if (!loopcond) {
         loopcond = AstInteger(1);
     }
-    EmitLabel(irl, toplabel);
+    EmitLoopLabel(irl, toplabel, loop);
     if (!atleastonce) {
         CompileBoolBranches(irl, loopcond, NULL, exitlabel);
     }
@@ -4183,6 +4855,67 @@ static AST *GetResultExpr(AST *resultval)
     return resultval;
 }
 
+//
+// code for branches which the profile says are rarely taken; it is
+// placed at the end of the function (and later moved after the return)
+// so that the common path falls straight through
+//
+static IRList coldcode;
+
+static bool CompileColdIf(IRList *irl, AST *ast)
+{
+    AST *cond = ast->left;
+    AST *thenelse = ast->right;
+    AST *hot, *cold;
+    AST *comments = NULL;
+    int coldarm;
+    int starttempreg = FuncData(curfunc)->curtempreg;
+    Operand *coldlabel, *donelabel;
+    IRList coldirl;
+
+    // in COG memory a jump is as cheap as falling through, and
+    // code inside a loop has to stay there for FCACHE; functions
+    // which will be inlined into their only caller are left alone too
+    if (curfunc->cog_code || COG_CODE || quitlabel) {
+        return false;
+    }
+    if ((gl_optimize_flags & OPT_INLINE_SINGLEUSE) && curfunc->callSites == 1 && RemoveIfInlined(curfunc)) {
+        return false;
+    }
+    coldarm = ProfileColdBranch(curfunc, ast);
+    if (!coldarm) {
+        return false;
+    }
+    if (thenelse->kind == AST_COMMENTEDNODE) {
+        comments = thenelse->right;
+        thenelse = thenelse->left;
+    }
+    cold = (coldarm == 1) ? thenelse->left : thenelse->right;
+    if (!cold) {
+        return false;
+    }
+    EmitComments(irl, comments);
+    coldlabel = NewCodeLabel();
+    donelabel = NewCodeLabel();
+    if (coldarm == 1) {
+        hot = thenelse->right;
+        CompileBoolBranches(irl, cond, coldlabel, NULL);
+    } else {
+        hot = thenelse->left;
+        CompileBoolBranches(irl, cond, NULL, coldlabel);
+    }
+    FreeTempRegisters(irl, starttempreg);
+    CompileStatementList(irl, hot);
+    EmitLabel(irl, donelabel);
+
+    coldirl.head = coldirl.tail = NULL;
+    EmitLabel(&coldirl, coldlabel);
+    CompileStatementList(&coldirl, cold);
+    EmitJump(&coldirl, COND_TRUE, donelabel);
+    AppendIRList(&coldcode, &coldirl);
+    return true;
+}
+
 static void CompileStatement(IRList *irl, AST *ast)
 {
     AST *retval;
@@ -4321,7 +5054,7 @@ static void CompileStatement(IRList *irl, AST *ast)
         toploop = NewCodeLabel();
 	botloop = NewCodeLabel();
 	PushQuitNext(botloop, toploop);
-	EmitLabel(irl, toploop);
+	EmitLoopLabel(irl, toploop, ast);
         CompileBoolBranches(irl, ast->left, NULL, botloop);
 	FreeTempRegisters(irl, starttempreg);
         CompileStatementList(irl, ast->right);
@@ -4334,7 +5067,7 @@ static void CompileStatement(IRList *irl, AST *ast)
 	botloop = NewCodeLabel();
 	exitloop = NewCodeLabel();
 	PushQuitNext(exitloop, botloop);
-	EmitLabel(irl, toploop);
+	EmitLoopLabel(irl, toploop, ast);
         CompileStatementList(irl, ast->right);
 	EmitLabel(irl, botloop);
         CompileBoolBranches(irl, ast->left, toploop, NULL);
@@ -4387,6 +5120,9 @@ static void CompileStatement(IRList *irl, AST *ast)
 	break;
     case AST_IF:
         EmitDebugComment(irl, ast->left);
+        if (CompileColdIf(irl, ast)) {
+            break;
+        }
         toploop = NewCodeLabel();
         CompileBoolBranches(irl, ast->left, NULL, toploop);
 	FreeTempRegisters(irl, starttempreg);
@@ -4508,9 +5244,17 @@ CompileFunctionBody(Function *f)
         }
     }
     // check for __fromfile
+    coldcode.head = coldcode.tail = NULL;
     if (f->body && f->body->kind != AST_STRING) {
         CompileStatementList(irl, f->body);
     }
+    if (coldcode.head) {
+        IR *ir = EmitJump(irl, COND_TRUE, FuncData(f)->asmreturnlabel);
+        ir->flags |= FLAG_KEEP_INSTR;
+        FuncData(f)->coldjump = ir;
+        AppendIRList(irl, &coldcode);
+        coldcode.head = coldcode.tail = NULL;
+    }
     EmitFunctionEpilog(irl, f);
     OptimizeIRLocal(irl, f);
 }
@@ -4520,14 +5264,49 @@ CompileFunctionBody(Function *f)
  * called late (after all optimizations have been finished)
  */
 
+/*
+ * remove the rarely used code following FuncData(f)->coldjump
+ * (up to the function epilog) from the function body
+ */
+static void
+SplitColdCode(IRList *firl, Function *f, IRList *cold)
+{
+    IR *jump = FuncData(f)->coldjump;
+    IR *ir, *next;
+
+    for (ir = firl->head; ir && ir != jump; ir = ir->next)
+        ;
+    if (!ir) {
+        // the optimizer got rid of it
+        return;
+    }
+    ir = jump->next;
+    DeleteIR(firl, jump);
+    while (ir && !(ir->opc == OPC_LABEL && ir->dst == FuncData(f)->asmreturnlabel)) {
+        next = ir->next;
+        DeleteIR(firl, ir);
+        ir->prev = ir->next = NULL;
+        AppendIR(cold, ir);
+        ir = next;
+    }
+}
+
 static void
 CompileWholeFunction(IRList *irl, Function *f)
 {
     IRList *firl = FuncIRL(f);
+    IRList cold;
 
+    cold.head = cold.tail = NULL;
     EmitFunctionHeader(irl, f);
+    if (FuncData(f)->coldjump) {
+        SplitColdCode(firl, f, &cold);
+    }
     AppendIRList(irl, firl);
     EmitFunctionFooter(irl, f);
+    if (cold.head) {
+        AppendIRList(irl, &cold);
+    }
 }
 
 static Operand *newlineOp;
@@ -4552,6 +5331,292 @@ static int gcmpfunc(const void *a, const void *b)
 #define SORT_ALPHABETICALLY 1
 #define NO_SORT 0
 
+// set once MarkUsedStrings has worked out which strings are needed
+static int stringsMarked;
+
+static void
+MarkStringOperand(Operand *op)
+{
+    if (!op) return;
+    switch (op->kind) {
+    case STRING_DEF:
+        op->used = 1;
+        break;
+    case REG_HUBPTR:
+    case REG_COGPTR:
+        MarkStringOperand((Operand *)op->val);
+        break;
+    case HUBMEM_REF:
+    case COGMEM_REF:
+        MarkStringOperand((Operand *)op->name);
+        break;
+    default:
+        break;
+    }
+}
+
+//
+// find the strings still referenced by the final code; strings
+// used only in code that was optimized away need not be emitted
+//
+static void
+MarkUsedStrings(IRList *irl)
+{
+    size_t siz = flexbuf_curlen(&hubGlobalVars) / sizeof(AsmVariable);
+    AsmVariable *g = (AsmVariable *)flexbuf_peek(&hubGlobalVars);
+    size_t i;
+    IR *ir;
+
+    for (i = 0; i < siz; i++) {
+        if (g[i].op->kind == STRING_DEF) {
+            g[i].op->used = 0;
+        }
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        MarkStringOperand(ir->dst);
+        MarkStringOperand(ir->src);
+        MarkStringOperand(ir->src2);
+    }
+    stringsMarked = 1;
+}
+
+static bool
+IsUnusedString(Operand *op)
+{
+    return stringsMarked && op && op->kind == STRING_DEF && !op->used;
+}
+
+//
+// string literal pool: identical strings, and strings which are the
+// tail end of another string, share the same memory
+//
+typedef struct PooledString {
+    Operand *op;
+    AST *ast;
+    unsigned char *data;  // contents, including the trailing 0
+    int len;
+    int owner;            // index of the string whose bytes we use
+    int offset;           // where our bytes start within the owner
+} PooledString;
+
+static PooledString *stringpool;
+static int nstringpool;
+
+static bool
+IsWritableString(Operand *op)
+{
+    OperandList *x;
+
+    for (x = writableStrings; x; x = x->next) {
+        if (x->op == op) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// get the contents of a string; returns 0 if they are not constant
+static int
+GetStringBytes(AST *ast, struct flexbuf *fb)
+{
+    AST *item;
+    const char *s;
+
+    while (ast) {
+        if (ast->kind == AST_EXPRLIST) {
+            item = ast->left;
+            ast = ast->right;
+        } else {
+            item = ast;
+            ast = NULL;
+        }
+        switch (item->kind) {
+        case AST_STRING:
+            for (s = item->d.string; *s; s++) {
+                flexbuf_addchar(fb, *s);
+            }
+            break;
+        case AST_INTEGER:
+            flexbuf_addchar(fb, item->d.ival);
+            break;
+        default:
+            if (!IsConstExpr(item)) {
+                return 0;
+            }
+            flexbuf_addchar(fb, EvalConstExpr(item));
+            break;
+        }
+    }
+    flexbuf_addchar(fb, 0);
+    return 1;
+}
+
+// compare strings from their last byte backwards
+static int
+CompareReversed(const void *a, const void *b)
+{
+    const PooledString *x = *(const PooledString **)a;
+    const PooledString *y = *(const PooledString **)b;
+    int i;
+    int n = (x->len < y->len) ? x->len : y->len;
+
+    for (i = 1; i <= n; i++) {
+        int cx = x->data[x->len - i];
+        int cy = y->data[y->len - i];
+        if (cx != cy) {
+            return cx - cy;
+        }
+    }
+    return x->len - y->len;
+}
+
+static bool
+IsSuffixOf(PooledString *s, PooledString *t)
+{
+    return s->len <= t->len && !memcmp(s->data, t->data + t->len - s->len, s->len);
+}
+
+//
+// find the strings which can share memory with other strings
+// returns the number of bytes saved
+//
+static int
+BuildStringPool(struct flexbuf *fb)
+{
+    size_t siz = flexbuf_curlen(fb) / sizeof(AsmVariable);
+    AsmVariable *g = (AsmVariable *)flexbuf_peek(fb);
+    PooledString **sorted;
+    PooledString *prev, *cur;
+    struct flexbuf data;
+    size_t i;
+    int n = 0;
+    int saved = 0;
+
+    stringpool = (PooledString *)calloc(siz + 1, sizeof(PooledString));
+    for (i = 0; i < siz; i++) {
+        if (g[i].op->kind != STRING_DEF || IsUnusedString(g[i].op)) {
+            continue;
+        }
+        if (IsWritableString(g[i].op)) {
+            continue;
+        }
+        flexbuf_init(&data, 64);
+        if (!GetStringBytes((AST *)g[i].val, &data)) {
+            flexbuf_delete(&data);
+            continue;
+        }
+        stringpool[n].op = g[i].op;
+        stringpool[n].ast = (AST *)g[i].val;
+        stringpool[n].len = flexbuf_curlen(&data);
+        stringpool[n].data = (unsigned char *)flexbuf_get(&data);
+        stringpool[n].owner = n;
+        stringpool[n].offset = 0;
+        n++;
+    }
+    nstringpool = n;
+
+    // after sorting by reversed contents, a string which is the tail
+    // of another comes just before it (or before another string
+    // with the same tail)
+    sorted = (PooledString **)calloc(n + 1, sizeof(PooledString *));
+    for (i = 0; i < n; i++) {
+        sorted[i] = &stringpool[i];
+    }
+    qsort(sorted, n, sizeof(PooledString *), CompareReversed);
+    prev = NULL;
+    for (i = n; i > 0; --i) {
+        cur = sorted[i-1];
+        if (prev && IsSuffixOf(cur, prev)) {
+            cur->owner = prev->owner;
+            cur->offset = prev->offset + prev->len - cur->len;
+            saved += cur->len;
+        }
+        prev = cur;
+    }
+    free(sorted);
+    return saved;
+}
+
+// emit string bytes, using quoted strings where we can
+static void
+EmitStringBytes(IRList *irl, const unsigned char *data, int len)
+{
+    char *str;
+    int n;
+
+    while (len > 0) {
+        if (*data == 0) {
+            EmitOp1(irl, OPC_BYTE, NewImmediate(0));
+            data++;
+            --len;
+            continue;
+        }
+        for (n = 0; n < len && data[n] != 0; n++)
+            ;
+        str = (char *)malloc(n + 1);
+        memcpy(str, data, n);
+        str[n] = 0;
+        EmitOp1(irl, OPC_STRING, NewOperand(IMM_STRING, str, 0));
+        data += n;
+        len -= n;
+    }
+}
+
+//
+// emit a string from the pool, along with the labels of all the
+// strings that share its memory; returns the number of bytes emitted
+//
+static int
+EmitPooledString(IRList *irl, Operand *op, AST *ast)
+{
+    PooledString *s = NULL;
+    int i, j;
+    int pos, next;
+    int sharers = 0;
+
+    for (i = 0; i < nstringpool; i++) {
+        if (stringpool[i].op == op) {
+            s = &stringpool[i];
+            break;
+        }
+    }
+    if (!s) {
+        EmitLabel(irl, op);
+        return EmitString(irl, ast);
+    }
+    if (s->owner != i) {
+        // emitted along with the string that holds our bytes
+        return 0;
+    }
+    for (j = 0; j < nstringpool; j++) {
+        if (stringpool[j].owner == i && j != i) {
+            sharers++;
+        }
+    }
+    if (!irl) {
+        return s->len;
+    }
+    if (sharers == 0) {
+        EmitLabel(irl, op);
+        return EmitString(irl, s->ast);
+    }
+    pos = 0;
+    while (pos < s->len) {
+        next = s->len;
+        for (j = 0; j < nstringpool; j++) {
+            if (stringpool[j].owner != i) continue;
+            if (stringpool[j].offset == pos) {
+                EmitLabel(irl, stringpool[j].op);
+            } else if (stringpool[j].offset > pos && stringpool[j].offset < next) {
+                next = stringpool[j].offset;
+            }
+        }
+        EmitStringBytes(irl, s->data + pos, next - pos);
+        pos = next;
+    }
+    return s->len;
+}
+
 // returns count of bytes emitted
 // if datairl or bssirl is NULL, nothing is actually output
 static int EmitAsmVars(struct flexbuf *fb, IRList *datairl, IRList *bssirl, int flags)
@@ -4583,8 +5648,18 @@ static int EmitAsmVars(struct flexbuf *fb, IRList *datairl, IRList *bssirl, int
       if (g[i].op->kind == REG_HW) {
 	continue;
       }
+      if (IsUnusedString(g[i].op)) {
+          continue;
+      }
+      if ((g[i].op->kind == REG_HUBPTR || g[i].op->kind == REG_COGPTR) && IsUnusedString((Operand *)g[i].val)) {
+          continue;
+      }
       switch(g[i].op->kind) {
       case STRING_DEF:
+          if (stringpool) {
+              count += EmitPooledString(datairl, g[i].op, (AST *)g[i].val);
+              break;
+          }
           EmitLabel(datairl, g[i].op);
           count += EmitString(datairl, (AST *)g[i].val);
           break;
@@ -4634,6 +5709,12 @@ static int EmitAsmVars(struct flexbuf *fb, IRList *datairl, IRList *bssirl, int
 static void EmitGlobals(IRList *cogdata, IRList *cogbss, IRList *hubdata)
 {
     EmitAsmVars(&cogGlobalVars, cogdata, cogbss, SORT_ALPHABETICALLY);
+    if ((gl_optimize_flags & OPT_MERGE_STRINGS) && !gl_compress) {
+        int saved = BuildStringPool(&hubGlobalVars);
+        if (saved > 0 && gl_printstats) {
+            printf("String pooling saved %d bytes\n", saved);
+        }
+    }
     EmitAsmVars(&hubGlobalVars, hubdata, NULL, NO_SORT);
 }
 
@@ -4642,6 +5723,9 @@ static void EmitGlobals(IRList *cogdata, IRList *cogbss, IRList *hubdata)
 #define VISITFLAG_COMPILEFUNCS  0x01230003
 #define VISITFLAG_EXPANDINLINE  0x01230004
 #define VISITFLAG_EMITDAT       0x01230005
+#define VISITFLAG_PLACEFUNCS    0x01230006
+#define VISITFLAG_COUNTCALLS    0x01230007
+#define VISITFLAG_MARKCALLS     0x01230008
 
 typedef void (*VisitorFunc)(IRList *irl, Module *P);
 
@@ -4902,28 +5986,32 @@ CompileFunc_internal(IRList *irl, Module *P)
           continue;
       curfunc = f;
       CompileFunctionBody(f);
-      FuncData(f)->isInline = ShouldBeInlined(f);
     }
     curfunc = savecurf;
 }
 
+static void
+CountCalls_internal(IRList *irl, Module *P)
+{
+    Function *f;
+    (void)irl; // not used
+    for(f = P->functions; f; f = f->next) {
+        if (ShouldSkipFunction(f))
+            continue;
+        CountInlineCalls(f);
+    }
+}
+
 static void
 ExpandInline_internal(IRList *irl, Module *P)
 {
     Function *f;
-    int change;
-    
+    (void)irl; // not used
+
     for (f = P->functions; f; f = f->next) {
-        IRList *firl = FuncIRL(f);
         if (ShouldSkipFunction(f))
             continue;
-        curfunc = f;
-        for(;;) {
-            change = ExpandInlines(firl);
-            if (!change) break;
-            // may be new opportunities for optimization
-            OptimizeIRLocal(firl, f);
-        }
+        ExpandFunctionInlines(f);
     }
 }
 
@@ -4934,7 +6022,67 @@ CompileIntermediate(Module *P)
     
     VisitRecursive(NULL, P, AssignFuncNames, VISITFLAG_FUNCNAMES);
     VisitRecursive(NULL, P, CompileFunc_internal, VISITFLAG_COMPILEFUNCS);
+    VisitRecursive(NULL, P, CountCalls_internal, VISITFLAG_COUNTCALLS);
+    if (P == globalModule) {
+        // the system functions are inlined along with the main
+        // program, once we know how often they are called
+        return;
+    }
+    ChooseInlines();
     VisitRecursive(NULL, P, ExpandInline_internal, VISITFLAG_EXPANDINLINE);
+    VisitRecursive(NULL, globalModule, ExpandInline_internal, VISITFLAG_EXPANDINLINE);
+}
+
+//
+// returns true if code for f will be output
+//
+static bool
+FunctionIsEmitted(Function *f)
+{
+    // if the function was private and has
+    // been inlined, skip it
+    if (ShouldSkipFunction(f)) {
+        return false;
+    }
+    if (RemoveIfInlined(f)) {
+        // system functions were not skipped in ShouldSkipFunction,
+        // so skip them here if they are not used
+        // also skip inlined private and single-use functions
+        if (FuncData(f)->isInline) {
+            return false;
+        }
+        if (!f->callSites) {
+            return false;
+        }
+        // leaf functions inlined into FCACHE loops may have no
+        // other callers left
+        if (FuncData(f)->fcacheInlined && !FuncData(f)->stillCalled) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// find the functions which are still called after inlining
+//
+static void
+MarkCalledFuncs(IRList *irl, Module *P)
+{
+    Function *f;
+    IR *ir;
+
+    (void)irl;
+    for (f = P->functions; f; f = f->next) {
+        if (!FunctionIsEmitted(f)) {
+            continue;
+        }
+        for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+            if (ir->opc == OPC_CALL && ir->aux) {
+                FuncData((Function *)ir->aux)->stillCalled = true;
+            }
+        }
+    }
 }
 
 static void
@@ -4945,51 +6093,395 @@ CompileToIR_internal(IRList *irl, Module *P)
 
     // emit output for P
     for(f = P->functions; f; f = f->next) {
-        // if the function was private and has
-        // been inlined, skip it
-        if (ShouldSkipFunction(f)) {
+        if (!FunctionIsEmitted(f)) {
             continue;
         }
-        if (RemoveIfInlined(f)) {
-            // system functions were not skipped in ShouldSkipFunction,
-            // so skip them here if they are not used
-            // also skip inlined private and single-use functions
-            if (FuncData(f)->isInline) {
-                continue;
-            }
-            if (!f->callSites) {
-                continue;
-            }
-        }
         curfunc = f;
+        if (FuncData(f)->placement) {
+            EmitNewline(FuncData(f)->placement);
+            CompileWholeFunction(FuncData(f)->placement, f);
+            continue;
+        }
 	EmitNewline(irl);
         CompileWholeFunction(irl, f);
     }
     curfunc = save;
 }
 
-bool
-CompileToIR(IRList *irl, Module *P)
-{
-    // generate code for inlining
-    CompileIntermediate(P);
-    // and generate real output
-    VisitRecursive(irl, P, CompileToIR_internal, VISITFLAG_COMPILEIR);
-    
-    return gl_errors == 0;
-}
 /*
- * emit builtin functions like mul and div
+ * automatic placement of frequently called functions in COG or LUT
+ *
+ * Every function which is output gets a weight estimating how often
+ * it is called: the count from the profile if there is one, otherwise
+ * the sum over its call sites of the caller's weight, multiplied by 8
+ * for each loop the call is inside. Small leaf functions are then
+ * packed into the free part of LUT (on P2) and into any COG space
+ * given with --cogplace, choosing the set with the largest total of
+ * weight*size which fits.
  */
-static const char *builtin_mul_p1 =
-"\nunsmultiply_\n"
-"\tmov\titmp2_, #0\n"
-"\tjmp\t#do_multiply_\n"
-"\nmultiply_\n"
-"\tmov\titmp2_, muldiva_\n"
-"\txor\titmp2_, muldivb_\n"
-"\tabs\tmuldiva_, muldiva_\n"
-"\tabs\tmuldivb_, muldivb_\n"
+
+// FCACHE uses the bottom of LUT and the block move routines use the
+// top 64 longs; placed functions go in between, from $100 or the end
+// of FCACHE if that is higher
+#define LUT_PLACE_ADDR 0x100
+#define LUT_SCRATCH_ADDR 0x1c0
+
+static int lutPlaceAddr = LUT_PLACE_ADDR;
+
+#define MAX_PLACE_WEIGHT 0x10000000U
+
+static IRList lutcode;
+static IRList cogplaced;
+static struct flexbuf placefuncs;
+
+typedef struct PlaceInfo {
+    Function *func;
+    unsigned weight;
+    int size;      // size in longs, or -1 if it cannot be moved
+} PlaceInfo;
+
+static void
+CollectPlaceFuncs(IRList *irl, Module *P)
+{
+    PlaceInfo info;
+
+    (void)irl;
+    for (info.func = P->functions; info.func; info.func = info.func->next) {
+        if (FunctionIsEmitted(info.func)) {
+            info.weight = 0;
+            info.size = -1;
+            flexbuf_addmem(&placefuncs, (char *)&info, sizeof(info));
+        }
+    }
+}
+
+static bool
+IsFunctionLabel(IRList *irl, Operand *op)
+{
+    IR *ir;
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst == op) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//
+// find the size (in longs) of f when run from COG memory, or -1
+// if f cannot be moved there
+//
+static int
+PlacedSize(Function *f)
+{
+    IRList *irl = FuncIRL(f);
+    IR *ir;
+    int n = 1; // for the ret
+
+    if (!IS_LEAF(f) || f->is_recursive || f->cog_code || f->cog_task
+        || f->toplevel || f->used_as_ptr || f->uses_alloca
+        || ANY_VARS_ON_STACK(f) || FuncData(f)->asmaltname)
+    {
+        return -1;
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (IsDummy(ir) || ir->opc == OPC_LABEL) {
+            continue;
+        }
+        switch (ir->opc) {
+        case OPC_CALL:
+            // only calls to the builtin routines in COG are allowed
+            if (!ir->dst || ir->dst->kind != IMM_COG_LABEL) {
+                return -1;
+            }
+            break;
+        case OPC_LITERAL:
+        case OPC_FCACHE:
+        case OPC_ORG:
+        case OPC_HUBMODE:
+        case OPC_JMPREL:
+            return -1;
+        default:
+            break;
+        }
+        if (!IsJump(ir) && ir->opc != OPC_REPEAT) {
+            // the function's own labels may only be used by jumps,
+            // since their addresses change
+            if (ir->dst && ir->dst->kind == IMM_HUB_LABEL && IsFunctionLabel(irl, ir->dst)) {
+                return -1;
+            }
+            if (ir->src && ir->src->kind == IMM_HUB_LABEL && IsFunctionLabel(irl, ir->src)) {
+                return -1;
+            }
+        }
+        n++;
+        if (gl_p2 && ir->src) {
+            // count the augs needed for large constants
+            if ( (ir->src->kind == IMM_INT && (ir->src->val < 0 || ir->src->val > 511))
+                 || ir->src->kind == STRING_DEF
+                 || (ir->src->kind == IMM_HUB_LABEL && !IsJump(ir)) )
+            {
+                n++;
+            }
+        }
+        if (gl_p2 && ir->dst && ir->dst->kind == IMM_INT && (ir->dst->val < 0 || ir->dst->val > 511)) {
+            n++;
+        }
+    }
+    return n;
+}
+
+static PlaceInfo *
+FindPlaceInfo(PlaceInfo *info, int n, Operand *op)
+{
+    int i;
+    for (i = 0; i < n; i++) {
+        if (FuncData(info[i].func)->asmname == op) {
+            return &info[i];
+        }
+    }
+    return NULL;
+}
+
+static unsigned
+AddWeight(unsigned a, unsigned b)
+{
+    a += b;
+    return (a > MAX_PLACE_WEIGHT) ? MAX_PLACE_WEIGHT : a;
+}
+
+//
+// estimate call counts from the call sites
+//
+static void
+EstimateCallWeights(PlaceInfo *info, int n)
+{
+    unsigned *newweight = (unsigned *)calloc(n, sizeof(unsigned));
+    struct flexbuf loops;
+    int i, j, pass;
+    IR *ir, *lab;
+    bool change;
+
+    flexbuf_init(&loops, 256);
+    for (pass = 0; pass < 16; pass++) {
+        for (i = 0; i < n; i++) {
+            Function *f = info[i].func;
+            newweight[i] = (f->toplevel || f->is_public || f->cog_task || f->used_as_ptr) ? 1 : 0;
+        }
+        for (i = 0; i < n; i++) {
+            IRList *irl = FuncIRL(info[i].func);
+            unsigned addr = 0;
+            IR **loop;
+            int numloops;
+
+            if (info[i].weight == 0) {
+                continue;
+            }
+            // find the loops, i.e. jumps backwards to a label
+            for (ir = irl->head; ir; ir = ir->next) {
+                ir->addr = addr++;
+            }
+            flexbuf_clear(&loops);
+            for (ir = irl->head; ir; ir = ir->next) {
+                if (!IsJump(ir)) continue;
+                for (lab = ir->prev; lab; lab = lab->prev) {
+                    if (lab->opc == OPC_LABEL && lab->dst == JumpDest(ir)) {
+                        flexbuf_addmem(&loops, (char *)&lab, sizeof(lab));
+                        flexbuf_addmem(&loops, (char *)&ir, sizeof(ir));
+                        break;
+                    }
+                }
+            }
+            loop = (IR **)flexbuf_peek(&loops);
+            numloops = flexbuf_curlen(&loops) / (2*sizeof(IR *));
+            for (ir = irl->head; ir; ir = ir->next) {
+                PlaceInfo *callee;
+                unsigned w;
+                if (ir->opc != OPC_CALL) continue;
+                callee = FindPlaceInfo(info, n, ir->dst);
+                if (!callee) continue;
+                w = info[i].weight;
+                for (j = 0; j < numloops; j++) {
+                    if (loop[2*j]->addr <= ir->addr && ir->addr <= loop[2*j+1]->addr) {
+                        w = (w > MAX_PLACE_WEIGHT/8) ? MAX_PLACE_WEIGHT : w*8;
+                    }
+                }
+                newweight[callee - info] = AddWeight(newweight[callee - info], w);
+            }
+        }
+        change = false;
+        for (i = 0; i < n; i++) {
+            if (info[i].weight != newweight[i]) {
+                change = true;
+                info[i].weight = newweight[i];
+            }
+        }
+        if (!change) break;
+    }
+    flexbuf_delete(&loops);
+    free(newweight);
+}
+
+//
+// move f into COG memory: its code goes into list irl, and all of its
+// labels become COG labels
+//
+static void
+PlaceFunction(Function *f, IRList *irl)
+{
+    IR *ir;
+
+    FuncData(f)->placement = irl;
+    FuncData(f)->asmname->kind = IMM_COG_LABEL;
+    FuncData(f)->asmretname->kind = IMM_COG_LABEL;
+    FuncData(f)->asmreturnlabel->kind = IMM_COG_LABEL;
+    for (ir = FuncIRL(f)->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst->kind == IMM_HUB_LABEL) {
+            ir->dst->kind = IMM_COG_LABEL;
+        }
+    }
+}
+
+//
+// choose functions to fill "space" longs so as to get the largest
+// total weight*size, and place them in irl; returns the space used
+//
+static int
+PackFunctions(PlaceInfo *info, int n, int space, IRList *irl)
+{
+    double *best;
+    char *keep;
+    int i, c, used = 0;
+
+    if (space <= 0) {
+        return 0;
+    }
+    best = (double *)calloc(space+1, sizeof(double));
+    keep = (char *)calloc((size_t)n * (space+1), 1);
+    for (i = 0; i < n; i++) {
+        int size = info[i].size;
+        double value;
+        // functions called only once are not worth moving
+        if (size <= 0 || size > space || info[i].weight < 2 || FuncData(info[i].func)->placement) {
+            continue;
+        }
+        value = (double)info[i].weight * size;
+        for (c = space; c >= size; --c) {
+            if (best[c-size] + value > best[c]) {
+                best[c] = best[c-size] + value;
+                keep[i*(space+1) + c] = 1;
+            }
+        }
+    }
+    c = space;
+    for (i = n-1; i >= 0; --i) {
+        if (keep[i*(space+1) + c]) {
+            PlaceFunction(info[i].func, irl);
+            c -= info[i].size;
+            used += info[i].size;
+        }
+    }
+    free(keep);
+    free(best);
+    return used;
+}
+
+static void
+PlaceHotFunctions(Module *P)
+{
+    PlaceInfo *info;
+    int i, n;
+    int lutspace = 0;
+    if (COG_CODE || gl_output == OUTPUT_COGSPIN || !GetMainFunction(P)) {
+        return;
+    }
+    if (gl_p2 && (gl_optimize_flags & OPT_AUTO_PLACE)) {
+        int fcache = (gl_fcache_size < 0) ? GuessFcacheSize(NULL) : gl_fcache_size;
+        lutPlaceAddr = (fcache > LUT_PLACE_ADDR) ? fcache : LUT_PLACE_ADDR;
+        lutspace = LUT_SCRATCH_ADDR - lutPlaceAddr;
+        if (lutspace < 0) {
+            lutspace = 0;
+        }
+    }
+    if (lutspace == 0 && gl_cogplace_size == 0) {
+        return;
+    }
+    flexbuf_init(&placefuncs, 1024);
+    VisitRecursive(NULL, P, CollectPlaceFuncs, VISITFLAG_PLACEFUNCS);
+    VisitRecursive(NULL, globalModule, CollectPlaceFuncs, VISITFLAG_PLACEFUNCS);
+    info = (PlaceInfo *)flexbuf_peek(&placefuncs);
+    n = flexbuf_curlen(&placefuncs) / sizeof(PlaceInfo);
+
+    EstimateCallWeights(info, n);
+    for (i = 0; i < n; i++) {
+        int calls = gl_profile_use ? ProfileFunctionCalls(info[i].func) : -1;
+        if (calls >= 0) {
+            info[i].weight = calls;
+        }
+        info[i].size = PlacedSize(info[i].func);
+    }
+    PackFunctions(info, n, lutspace, &lutcode);
+    PackFunctions(info, n, gl_cogplace_size, &cogplaced);
+    flexbuf_delete(&placefuncs);
+}
+
+//
+// output the functions placed in LUT into hub memory, and the code
+// to load them (which goes after "entry", so cogs started to run
+// Spin methods load it as well)
+//
+static void
+EmitLutCode(IRList *irl, IRList *cogirl, IR *entry)
+{
+    IR *ir;
+    char *loadcode;
+    
+    EmitLabel(irl, NewOperand(IMM_HUB_LABEL, "__lutcode_start", 0));
+    EmitOp1(irl, OPC_ORG, NewImmediate(0x200 + lutPlaceAddr));
+    AppendIRList(irl, &lutcode);
+    EmitOp1(irl, OPC_LITERAL, NewOperand(IMM_STRING, "\tfit\t$3c0\n", 0));
+    EmitOp0(irl, OPC_HUBMODE);
+    EmitLabel(irl, NewOperand(IMM_HUB_LABEL, "__lutcode_end", 0));
+
+    loadcode = (char *)malloc(128);
+    sprintf(loadcode,
+            "\tmov\tpb, ##@__lutcode_start\n"
+            "\tsetq2\t#(__lutcode_end - __lutcode_start)/4 - 1\n"
+            "\trdlong\t$%x, pb\n", lutPlaceAddr);
+    ir = NewIR(OPC_LITERAL);
+    ir->dst = NewOperand(IMM_STRING, loadcode, 0);
+    InsertAfterIR(cogirl, entry, ir);
+}
+
+bool
+CompileToIR(IRList *irl, Module *P)
+{
+    // generate code for inlining
+    CompileIntermediate(P);
+    VisitRecursive(NULL, P, MarkCalledFuncs, VISITFLAG_MARKCALLS);
+    VisitRecursive(NULL, globalModule, MarkCalledFuncs, VISITFLAG_MARKCALLS);
+    // decide which functions go in COG or LUT
+    PlaceHotFunctions(P);
+    // and generate real output
+    VisitRecursive(irl, P, CompileToIR_internal, VISITFLAG_COMPILEIR);
+    
+    return gl_errors == 0;
+}
+/*
+ * emit builtin functions like mul and div
+ */
+static const char *builtin_mul_p1 =
+"\nunsmultiply_\n"
+"\tmov\titmp2_, #0\n"
+"\tmovs\tmultiply__ret, unsmultiply__ret\n"
+"\tjmp\t#do_multiply_\n"
+"unsmultiply__ret\n"
+"\tret\n"
+"\nmultiply_\n"
+"\tmov\titmp2_, muldiva_\n"
+"\txor\titmp2_, muldivb_\n"
+"\tabs\tmuldiva_, muldiva_\n"
+"\tabs\tmuldivb_, muldivb_\n"
 "do_multiply_\n"
 "\tmov\tresult1, #0\n"
 "\tmov\titmp1_, #32\n"
@@ -5012,7 +6504,10 @@ static const char *builtin_mul_p1 =
 static const char *builtin_mul_p1_fast =
 "\nunsmultiply_\n"
 "       mov    itmp2_, #0\n"
+"       movs   multiply__ret, unsmultiply__ret\n"
 "       jmp    #do_multiply_\n"
+"unsmultiply__ret\n"
+"       ret\n"
 "\nmultiply_\n"
 "       mov    itmp2_, muldiva_\n"
 "       xor    itmp2_, muldivb_\n"
@@ -5094,6 +6589,32 @@ static const char *builtin_div_p1 =
 "DIVCNT\n"
 "\tlong\t0\n"
 ;
+/*
+ * unsigned 64 bit by 32 bit divide, for FRAC on P1
+ * calculates (muldiva_ << 32) / muldivb_, shifting the dividend
+ * left through muldiva_ and keeping the 33rd bit in C
+ * quotient in muldivb_, remainder in muldiva_; if the quotient does
+ * not fit in 32 bits (including division by 0) it is $FFFFFFFF,
+ * as on P2
+ */
+static const char *builtin_frac_p1 =
+"\nfrac_\n"
+"        neg     itmp1_, #1\n"
+"        cmp     muldiva_, muldivb_ wc\n"
+" if_nc  jmp     #frac_done_\n"
+"        mov     itmp2_, #32\n"
+"frac_lp_\n"
+"        shl     muldiva_, #1       wc\n"
+" if_c   sub     muldiva_, muldivb_\n"
+" if_nc  cmpsub  muldiva_, muldivb_ wc\n"
+"        rcl     itmp1_, #1\n"
+"        djnz    itmp2_, #frac_lp_\n"
+"frac_done_\n"
+"        mov     muldivb_, itmp1_\n"
+"frac__ret\n"
+"\tret\n"
+;
+
 static const char *builtin_div_p2 =
 "\nunsdivide_\n"
 "       setq    #0\n"
@@ -5121,6 +6642,7 @@ static const char *builtin_div_p2 =
 #include "sys/lmm_trace.spin.h"
 #include "sys/lmm_cache.spin.h"
 #include "sys/lmm_compress.spin.h"
+#include "sys/lmm_lru.spin.h"
 
 const char *builtin_fcache_p2 =
     "FCACHE_LOAD_\n"
@@ -5227,7 +6749,7 @@ const char *builtin_pushregs_p2 =
 /* WARNING: make sure to increase SETJMP_BUF_SIZE if you add
  * more things to be saved in abort/catch
  */
-static const char *builtin_abortcode_p1 =
+static const char *builtin_setjmp_p1 =
     "__setjmp\n"
     "    mov result1, #0\n"
     "    mov result2, #0\n"
@@ -5243,6 +6765,33 @@ static const char *builtin_abortcode_p1 =
     "    wrlong __setjmp_ret, arg01\n"
     "__setjmp_ret\n"
     "    ret\n"
+    ;
+
+/* with --lmm=lru the caller may be running from a cache line, which
+ * will not be there when we longjmp back; LMM_SETJMP_PC turns the
+ * return into a jump to the hub address in that case
+ */
+static const char *builtin_setjmp_lru =
+    "__setjmp\n"
+    "    mov result1, #0\n"
+    "    mov result2, #0\n"
+    "    mov abortchain, arg01\n"
+    "    mov LMM_SETJMP_RA, __setjmp_ret\n"
+    "    call #LMM_SETJMP_PC\n"
+    "    wrlong fp, arg01\n"
+    "    add arg01, #4\n"
+    "    wrlong pc, arg01\n"
+    "    add arg01, #4\n"
+    "    wrlong sp, arg01\n"
+    "    add arg01, #4\n"
+    "    wrlong objptr, arg01\n"
+    "    add arg01, #4\n"
+    "    wrlong LMM_SETJMP_RA, arg01\n"
+    "__setjmp_ret\n"
+    "    ret\n"
+    ;
+
+static const char *builtin_longjmp_p1 =
     // unwind_stack(curfp, lastfp) walks the frame pointer list and restores everything
     // until it reaches lastfp
     "__unwind_stack\n"
@@ -5355,6 +6904,9 @@ EmitBuiltins(IRList *irl)
             case LMM_KIND_COMPRESS:
                 builtin_lmm = (const char *)sys_lmm_compress_spin;
                 break;
+            case LMM_KIND_LRU:
+                builtin_lmm = (const char *)sys_lmm_lru_spin;
+                break;
             default:
                 builtin_lmm = (const char *)sys_lmm_orig_spin;
                 break;
@@ -5399,13 +6951,25 @@ EmitBuiltins(IRList *irl)
         (void)GetOneGlobal(REG_REG, "itmp2_", 0);
         (void)GetOneGlobal(REG_REG, "result1", 0);
     }
+    if (fracfunc) {
+        Operand *loop = NewOperand(IMM_STRING, builtin_frac_p1, 0);
+        EmitOp1(irl, OPC_LITERAL, loop);
+        (void)GetOneGlobal(REG_REG, "itmp1_", 0);
+        (void)GetOneGlobal(REG_REG, "itmp2_", 0);
+    }
     if (longjmpfunc) {
         Operand *loop;
 
         if (gl_p2) {
             loop = NewOperand(IMM_STRING, builtin_abortcode_p2, 0);
         } else {
-            loop = NewOperand(IMM_STRING, builtin_abortcode_p1, 0);
+            if (HUB_CODE && gl_lmm_kind == LMM_KIND_LRU) {
+                loop = NewOperand(IMM_STRING, builtin_setjmp_lru, 0);
+            } else {
+                loop = NewOperand(IMM_STRING, builtin_setjmp_p1, 0);
+            }
+            EmitOp1(irl, OPC_LITERAL, loop);
+            loop = NewOperand(IMM_STRING, builtin_longjmp_p1, 0);
         }
         EmitOp1(irl, OPC_LITERAL, loop);
         if (COG_CODE) {
@@ -5520,6 +7084,261 @@ EmitVarSection(IRList *irl, Module *P)
 
 extern Module *globalModule;
 
+/*
+ * with -fprofile-generate, print the profile when the main
+ * program returns
+ */
+static void
+EmitProfileDump(IRList *irl)
+{
+    Symbol *sym;
+    Function *f;
+
+    if (!gl_profile_generate) {
+        return;
+    }
+    sym = FindSymbol(&globalModule->objsyms, "_prof_dump");
+    if (!sym || sym->kind != SYM_FUNCTION) {
+        return;
+    }
+    f = (Function *)sym->val;
+    EmitOp1(irl, OPC_CALL, NewOperand(COG_CODE ? IMM_COG_LABEL : IMM_HUB_LABEL,
+                                      IdentifierModuleName(f->module, f->name), 0));
+}
+
+/*
+ * with --serial=buffered, call the serial routine name from the
+ * startup code
+ */
+static void
+EmitSerialCall(IRList *irl, const char *name)
+{
+    Symbol *sym;
+    Function *f;
+
+    if (!gl_serial_buffered) {
+        return;
+    }
+    sym = FindSymbol(&globalModule->objsyms, name);
+    if (!sym || sym->kind != SYM_FUNCTION) {
+        return;
+    }
+    f = (Function *)sym->val;
+    EmitOp1(irl, OPC_CALL, NewOperand(COG_CODE ? IMM_COG_LABEL : IMM_HUB_LABEL,
+                                      IdentifierModuleName(f->module, f->name), 0));
+}
+
+/*
+ * with --lmm=lru,stats, print the cache counters when the main
+ * program returns
+ */
+static void
+EmitLmmCacheStats(IRList *irl)
+{
+    Symbol *sym;
+    Function *f;
+
+    if (!HUB_CODE || gl_p2 || gl_lmm_kind != LMM_KIND_LRU || !gl_lmm_stats) {
+        return;
+    }
+    sym = FindSymbol(&globalModule->objsyms, "_lmm_cache_stats");
+    if (!sym || sym->kind != SYM_FUNCTION) {
+        return;
+    }
+    f = (Function *)sym->val;
+    EmitMove(irl, GetArgReg(0), NewOperand(REG_HW, "LMM_cache_lookups", 0));
+    EmitMove(irl, GetArgReg(1), NewOperand(REG_HW, "LMM_cache_misses", 0));
+    EmitOp1(irl, OPC_CALL, NewOperand(IMM_HUB_LABEL,
+                                      IdentifierModuleName(f->module, f->name), 0));
+}
+
+/*
+ * work out the shape of the --lmm=lru cache: as many sets (a power
+ * of 2) of gl_lmm_ways lines as will fit in the FCACHE size, and
+ * pass it to the kernel as constants
+ */
+static IR *lmm_sets_ir;
+static bool lmm_default_size;
+
+static void
+EmitLmmCacheConsts(IRList *irl)
+{
+    int linesize = gl_lmm_line_longs + 1; // each line ends with a jmp
+    int lines;
+    int sets = 1;
+    int log2 = 0;
+
+    lmm_default_size = (gl_fcache_size < 0);
+    if (gl_fcache_size < 0) {
+        // the kernel is bigger than the default one, so leave it
+        // some of the space FCACHE would normally get; once the
+        // rest of COG memory is known the cache is made bigger
+        gl_fcache_size = GuessFcacheSize(irl) * 2 / 3;
+    }
+    // the kernel also keeps a tag and an age for each line
+    lines = gl_fcache_size / (linesize + 2);
+    if (lines < gl_lmm_ways) {
+        if (!lmm_default_size) {
+            ERROR(NULL, "--fcache=%d is too small for %d ways of %d longs",
+                  gl_fcache_size, gl_lmm_ways, gl_lmm_line_longs);
+            return;
+        }
+        // the lines asked for need more than the usual share of COG
+        // memory; start with one set, and check that it fits once
+        // the rest of COG memory is known
+        lines = gl_lmm_ways;
+    }
+    while (2 * sets * gl_lmm_ways <= lines) {
+        sets *= 2;
+    }
+    while ((1<<log2) < gl_lmm_line_longs) {
+        log2++;
+    }
+    gl_fcache_size = sets * gl_lmm_ways * linesize;
+    EmitOp2(irl, OPC_CONST, NewOperand(IMM_STRING, "LMM_LINE_LONGS", gl_lmm_line_longs), NewImmediate(gl_lmm_line_longs));
+    EmitOp2(irl, OPC_CONST, NewOperand(IMM_STRING, "LMM_LINE_LOG2", log2), NewImmediate(log2));
+    lmm_sets_ir = EmitOp2(irl, OPC_CONST, NewOperand(IMM_STRING, "LMM_SETS", sets), NewImmediate(sets));
+    EmitOp2(irl, OPC_CONST, NewOperand(IMM_STRING, "LMM_WAYS", gl_lmm_ways), NewImmediate(gl_lmm_ways));
+    EmitOp2(irl, OPC_CONST, NewOperand(IMM_STRING, "LMM_CACHE_STATS", gl_lmm_stats), NewImmediate(gl_lmm_stats));
+}
+
+//
+// count the COG longs taken by one line of an assembly literal; the
+// cache tables sized by LMM_SETS are left out, since the caller
+// allows for them
+//
+static int
+CogLongsInLine(const char *line, int len)
+{
+    char buf[128];
+    char *p, *q;
+    int n;
+
+    if (len >= (int)sizeof(buf)) len = sizeof(buf) - 1;
+    strncpy(buf, line, len);
+    buf[len] = 0;
+    if ((p = strchr(buf, '\'')) != NULL) {
+        *p = 0;
+    }
+    p = buf;
+    if (*p && *p != ' ' && *p != '\t') {
+        // a label; skip it
+        while (*p && *p != ' ' && *p != '\t') p++;
+    }
+    while (*p == ' ' || *p == '\t') p++;
+    if (!*p) {
+        return 0;
+    }
+    if (!strncasecmp(p, "if_", 3)) {
+        while (*p && *p != ' ' && *p != '\t') p++;
+        while (*p == ' ' || *p == '\t') p++;
+    }
+    if (!strncasecmp(p, "fit", 3) || !strncasecmp(p, "org", 3) || strchr(p, '=')) {
+        return 0;
+    }
+    if (!strncasecmp(p, "res", 3)) {
+        return atoi(p + 3);
+    }
+    if (!strncasecmp(p, "long", 4)) {
+        if ((q = strchr(p, '[')) != NULL) {
+            if (strstr(q, "LMM_SETS")) return 0;
+            n = atoi(q + 1);
+            return n > 0 ? n : 1;
+        }
+        for (n = 1, q = p; *q; q++) {
+            if (*q == ',') n++;
+        }
+        return n;
+    }
+    return 1;
+}
+
+static int
+CogLongsInIR(IRList *irl, IR *stop)
+{
+    IR *ir;
+    const char *s, *e;
+    int n = 0;
+
+    for (ir = irl->head; ir && ir != stop; ir = ir->next) {
+        switch (ir->opc) {
+        case OPC_LITERAL:
+            for (s = ir->dst->name; *s; s = e) {
+                e = strchr(s, '\n');
+                if (!e) e = s + strlen(s);
+                n += CogLongsInLine(s, e - s);
+                if (*e) e++;
+            }
+            break;
+        case OPC_RESERVE:
+            n += ir->dst->val;
+            break;
+        case OPC_LONG:
+            n += (ir->src && ir->src->kind == IMM_INT) ? ir->src->val : 1;
+            break;
+        case OPC_CALL:
+            // a call from COG to a hub function goes through the kernel,
+            // and takes 3 longs
+            n += IsHubDest(ir->dst) ? 3 : 1;
+            break;
+        case OPC_LABEL:
+        case OPC_CONST:
+        case OPC_COMMENT:
+        case OPC_DUMMY:
+        case OPC_LIVE:
+        case OPC_REPEAT_END:
+        case OPC_ORG:
+        case OPC_FIT:
+        case OPC_HUBMODE:
+            break;
+        default:
+            if (ir->cond != COND_FALSE) {
+                n++;
+            }
+            break;
+        }
+    }
+    return n;
+}
+
+//
+// with the default size, make the --lmm=lru cache as big as the COG
+// memory left over allows, now that everything else in COG is known
+// (cog code up to stop, and the cog variables); if even one set of
+// the lines asked for does not fit, say so
+//
+static void
+GrowLmmCache(IRList *cogcode, IR *stop, IRList *cogdata, IRList *cogbss)
+{
+    int linesize = gl_lmm_line_longs + 1;
+    int sets, used, free;
+
+    if (!lmm_default_size || !lmm_sets_ir) {
+        return;
+    }
+    sets = lmm_sets_ir->src->val;
+    used = CogLongsInIR(cogcode, stop) + CogLongsInIR(cogdata, NULL)
+        + CogLongsInIR(cogbss, NULL);
+    // leave room for LMM_RETREG and the long after the cache
+    free = 496 - used - 2;
+    if (sets * gl_lmm_ways * (linesize + 2) > free) {
+        ERROR(NULL, "--lmm=lru cache of %d ways of %d longs needs %d longs of COG memory, but only %d are free",
+              gl_lmm_ways, gl_lmm_line_longs, sets * gl_lmm_ways * (linesize + 2), free < 0 ? 0 : free);
+        return;
+    }
+    // keep a few longs of slack in case the count above is a little
+    // short
+    free -= 8;
+    while (2 * sets * gl_lmm_ways * (linesize + 2) <= free) {
+        sets *= 2;
+    }
+    if (sets != lmm_sets_ir->src->val) {
+        lmm_sets_ir->src = NewImmediate(sets);
+        lmm_sets_ir->dst->val = sets;
+        gl_fcache_size = sets * gl_lmm_ways * linesize;
+    }
+}
+
 /*
  * emit a small main program
  * it looks something like:
@@ -5597,11 +7416,17 @@ EmitMain_P1(IRList *irl, Module *P)
         }
     }
 
+    // allocate the serial lock before any other cog can print
+    EmitSerialCall(irl, "_bufser_init");
     if (firstfunc->cog_code || COG_CODE) {
         EmitOp1(irl, OPC_CALL, NewOperand(IMM_COG_LABEL, firstfuncname, 0));
     } else {
         EmitOp1(irl, OPC_CALL, NewOperand(IMM_HUB_LABEL, firstfuncname, 0));
     }
+    EmitProfileDump(irl);
+    EmitLmmCacheStats(irl);
+    // wait for the helper cog to send everything
+    EmitSerialCall(irl, "_txflush");
     EmitLabel(irl, cogexit);
     EmitOp1(irl, OPC_COGID, arg1);
     EmitOp1(irl, OPC_COGSTOP, arg1);
@@ -5699,11 +7524,16 @@ EmitMain_P2(IRList *irl, Module *P)
     EmitOp2(irl, OPC_WRLONG, NewImmediate(clkfreq), clkfreq_addr);
 
     EmitLabel(irl, skip_clock_label);
+    // allocate the serial lock before any other cog can print
+    EmitSerialCall(irl, "_bufser_init");
     if (firstfunc->cog_code || COG_CODE) {
         EmitOp1(irl, OPC_CALL, NewOperand(IMM_COG_LABEL, firstfuncname, 0));
     } else {
         EmitOp1(irl, OPC_CALL, NewOperand(IMM_HUB_LABEL, firstfuncname, 0));
     }
+    EmitProfileDump(irl);
+    // wait for the helper cog to send everything
+    EmitSerialCall(irl, "_txflush");
     EmitLabel(irl, cogexit);
     EmitOp1(irl, OPC_WAITX, NewImmediate(160000)); // 1 ms delay at 160 MHz
     EmitOp1(irl, OPC_COGID, arg1);
@@ -5860,7 +7690,7 @@ static int guess_instructions_in_literal(const char *s)
 /* routine to try to guess how much room we need for fcache */
 /* this does not work very well at present */
 
-static int
+int
 GuessFcacheSize(IRList *irl)
 {
 #    /* for now, just go by p2/p1 */
@@ -5917,6 +7747,7 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
     IR *orgh = NULL;
     Operand *entrylabel = NewOperand(IMM_COG_LABEL, ENTRYNAME, 0);
     Operand *cog_bss_start = NewOperand(IMM_COG_LABEL, "COG_BSS_START", 0);
+    IR *entryir = NULL;
     bool emitSpinCode = true;
     
     const char *asmcode;
@@ -5937,6 +7768,11 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
             gl_hub_base = 0;
         }
     }
+    if (gl_p2 && gl_fcache_size > LUT_SCRATCH_ADDR) {
+        // FCACHE must not run into the block move buffer in LUT
+        WARNING(NULL, "FCACHE size %d is too big for P2, using %d", gl_fcache_size, LUT_SCRATCH_ADDR);
+        gl_fcache_size = LUT_SCRATCH_ADDR;
+    }
     InitAsmCode();
     CompileIntermediate(globalModule);
     
@@ -6018,10 +7854,13 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
         EmitOp1(&cogbss, OPC_ORG, cog_bss_start);
     }
     CompileConsts(&cogcode, P->conblock);
+    if (HUB_CODE && !gl_p2 && gl_lmm_kind == LMM_KIND_LRU) {
+        EmitLmmCacheConsts(&cogcode);
+    }
 
     if (emitSpinCode) {
         // output the main stub
-        EmitLabel(&cogcode, entrylabel);
+        entryir = EmitLabel(&cogcode, entrylabel);
         if (gl_output == OUTPUT_COGSPIN) {
             EmitMain_CogSpin(&cogcode, P, maxargs, maxrets);
         } else if (outputMain) {
@@ -6059,6 +7898,13 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
         } else {
             CompileSystemModule(&cogcode, globalModule);
         }
+        // and the functions moved into COG or LUT
+        if (cogplaced.head) {
+            AppendIRList(&cogcode, &cogplaced);
+        }
+        if (lutcode.head) {
+            EmitLutCode(&hubcode, &cogcode, entryir);
+        }
         // guesstimate how much space we will have for FCACHE, if
         // a dynamic size is requested
         if (gl_fcache_size < 0) {
@@ -6083,7 +7929,13 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
         OptimizeIRGlobal(&cogcode);
 
         // cog data
+        if ((gl_optimize_flags & OPT_REMOVE_UNUSED_DATA) && !gl_compress) {
+            MarkUsedStrings(&cogcode);
+        }
         EmitGlobals(&cogdata, &cogbss, &hubdata);
+        if (HUB_CODE && !gl_p2 && gl_lmm_kind == LMM_KIND_LRU) {
+            GrowLmmCache(&cogcode, orgh, &cogdata, &cogbss);
+        }
     
         // COG bss
         // FCACHE space
@@ -6097,6 +7949,16 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
     }
     
     // we need to emit all dat sections
+    if (datalabel) {
+        // the garbage collector scans from here a long at a time, and
+        // P2 rdlong does not align the address for us
+        if (gl_p2 || gl_compress) {
+            EmitOp1(&hubdata, OPC_LITERAL, NewOperand(IMM_STRING, "\talignl\n", 0));
+        } else {
+            EmitOp1(&hubdata, OPC_LITERAL, NewOperand(IMM_STRING, "\tlong\n", 0));
+        }
+        EmitLabel(&hubdata, datalabel);
+    }
     VisitRecursive(&hubdata, P, EmitDatSection, VISITFLAG_EMITDAT);
     VisitRecursive(&hubdata, globalModule, EmitDatSection, VISITFLAG_EMITDAT);
     
@@ -58,9 +58,15 @@ IR *EmitLabel(IRList *list, Operand *op);
 void OptimizeIRLocal(IRList *irl, Function *f);
 void OptimizeIRGlobal(IRList *irl);
 void OptimizeFcache(IRList *irl);
-bool ShouldBeInlined(Function *f);
+void OptimizeCogFifo(IRList *irl);
+void CountInlineCalls(Function *f);
+void ChooseInlines(void);
 bool RemoveIfInlined(Function *f);
+int  FrameSetupCost(Function *f);
 int  ExpandInlines(IRList *irl);
+void ExpandFunctionInlines(Function *f);
+int  GuessFcacheSize(IRList *irl);
+int  AllocateLocalRegs(IRList *irl, int isLeaf);
 
 bool IsDummy(IR *ir);
 bool IsValidDstReg(Operand *reg);
@@ -71,6 +77,7 @@ bool IsHwReg(Operand *reg);
 
 bool IsHubDest(Operand *dst);
 Operand *JumpDest(IR *ir);
+bool IsJump(IR *ir);
 
 typedef enum callconvention {
     FAST_CALL,   // arguments & return in registers, native call
@@ -117,14 +124,47 @@ typedef struct ir_bedata {
 
     /* number of local registers that need to be pushed */
     int numsavedregs;
+
+    /* jump to the function exit which is followed by rarely used
+       code; that code is moved after the return instruction when
+       the function is output */
+    IR *coldjump;
+
+    /* if the function was moved into COG or LUT memory automatically,
+       the list its code is emitted into (NULL otherwise) */
+    IRList *placement;
     
     /* flag for whether we should inline the function */
     bool isInline;
+    /* set if only the calls inside loops should be inlined */
+    bool isInlineInLoops;
+    /* set if some calls were inlined so a loop could use FCACHE, and
+       whether any calls to the function are left after that */
+    bool fcacheInlined;
+    bool stillCalled;
+
+    /* calls to the function, counted for the inliner: the number of
+       calls, the calls weighted by how often they probably run, and
+       the (weighted) number of constant arguments passed */
+    int inlineCalls;
+    int inlineWeight;
+    int inlineConstArgs;
+    /* size of the function body when we decided to inline it */
+    int inlineSize;
+    /* whether calls inside this function have been expanded yet */
+    int inlineState;
+
+    /* estimated clocks saved by scheduling around hub accesses */
+    int hubClocksSaved;
 
     /* type of calling convention */
     CallConvention convention;
 } IRFuncData;
 
+#define INLINE_NOT_EXPANDED 0
+#define INLINE_EXPANDING    1
+#define INLINE_EXPANDED     2
+
 #define FuncData(f) ((IRFuncData *)(f)->bedata)
 #define FuncIRL(f)  (&FuncData(f)->irl)
 
@@ -164,6 +204,7 @@ const char *VarName(AST *ast);
 // get operands for argument and result registers
 Operand *GetArgReg(int n);
 Operand *GetResultReg(int n);
+Operand *GetLocalReg(int n, int isLeaf);
 
 // convert to an effective address
 Operand *GetLea(IRList *irl, Operand *src);
@@ -101,6 +101,7 @@ Usage(FILE *f, int bstcMode)
     fprintf(f, "  [ -l ]             output DAT as a listing file\n");
     fprintf(f, "  [ -f ]             output list of file names\n");
     fprintf(f, "  [ -q ]             quiet mode (suppress banner and non-error text)\n");
+    fprintf(f, "  [ -v ]             print statistics about optimizations\n");
     fprintf(f, "  [ -p ]             disable the preprocessor\n");
     fprintf(f, "  [ -D <define> ]    add a define\n");
     fprintf(f, "  [ -u ]             ignore for openspin compatibility (unused method elimination always enabled)\n");
@@ -111,18 +112,29 @@ Usage(FILE *f, int bstcMode)
     fprintf(f, "          -O0 = no optimization\n");
     fprintf(f, "          -O1 = basic optimization\n");
     fprintf(f, "          -O2 = all optimization\n");
+    fprintf(f, "          -O3 = all optimization, inline more for speed\n");
+    fprintf(f, "          -Os = all optimization that does not make code bigger\n");
     fprintf(f, "  [ -H nnnn ]        set starting hub address\n");
     fprintf(f, "  [ -E ]             skip initial coginit code (usually used with -H)\n");
     fprintf(f, "  [ -w ]             compile for COG with Spin wrappers\n");
     fprintf(f, "  [ -C ]             enable case sensitive mode\n");
     fprintf(f, "  [ -x ]             capture program exit code (for testing)\n");
-    fprintf(f, "  [ -z ]             compress code\n");
+    fprintf(f, "  [ -z ]             compress code (-zv also prints statistics)\n");
+    fprintf(f, "  [ -fprofile-generate ] add code to print a profile when the program exits\n");
+    fprintf(f, "  [ -fprofile-use=file ] use a profile printed by -fprofile-generate to guide optimization\n");
     fprintf(f, "  [ --code=cog ]     compile for COG mode instead of LMM\n");
+    fprintf(f, "  [ --cogplace=N ]   put up to N longs of frequently called functions in COG memory\n");
     fprintf(f, "  [ --fcache=N ]     set FCACHE size to N (0 to disable)\n");
     fprintf(f, "  [ --fixedreal ]    use 16.16 fixed point in place of floats\n");
     fprintf(f, "  [ --lmm=xxx ]      use alternate LMM implementation for P1\n");
     fprintf(f, "           xxx = orig uses original fastspin LMM\n");
     fprintf(f, "           xxx = slow uses traditional (slow) LMM\n");
+    fprintf(f, "           xxx = lru[,line=N][,ways=N][,stats] uses a set associative cache\n");
+    fprintf(f, "                 of N long lines (default 8) and N ways (default 2);\n");
+    fprintf(f, "                 stats prints the cache hit rate at exit\n");
+    fprintf(f, "  [ --serial=xxx ]   choose how the console serial port is driven\n");
+    fprintf(f, "           xxx = direct (default) sends and receives in the calling cog\n");
+    fprintf(f, "           xxx = buffered uses a helper cog and ring buffers\n");
     
     fflush(stderr);
     exit(2);
@@ -282,6 +294,12 @@ main(int argc, const char **argv)
                 gl_fcache_size = 0;
             }
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--cogplace=", 11)) {
+            gl_cogplace_size = atoi(argv[0]+11);
+            if (gl_cogplace_size < 0) {
+                gl_cogplace_size = 0;
+            }
+            argv++; --argc;
         } else if (!strncmp(argv[0], "--fixed", 7)) {
             gl_fixedreal = 1;
             argv++; --argc;
@@ -296,18 +314,18 @@ main(int argc, const char **argv)
             }
             argv++; --argc;
         } else if (!strncmp(argv[0], "--lmm=", 6)) {
-            const char *lmmtype = argv[0]+6;
-            if (!strcmp(lmmtype, "orig")) {
-                gl_lmm_kind = LMM_KIND_ORIG;
-            } else if (!strcmp(lmmtype, "slow")) {
-                gl_lmm_kind = LMM_KIND_SLOW;
-                gl_fcache_size = 0;
-            } else if (!strcmp(lmmtype, "trace")) {
-                gl_lmm_kind = LMM_KIND_TRACE;
-            } else if (!strcmp(lmmtype, "cache")) {
-                gl_lmm_kind = LMM_KIND_CACHE;
+            if (!ParseLmmOption(argv[0]+6)) {
+                Usage(stderr, bstcMode);
+            }
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--serial=", 9)) {
+            const char *serialtype = argv[0]+9;
+            if (!strcmp(serialtype, "direct")) {
+                gl_serial_buffered = 0;
+            } else if (!strcmp(serialtype, "buffered")) {
+                gl_serial_buffered = 1;
             } else {
-                fprintf(stderr, "Unknown --lmm= choice: %s\n", lmmtype);
+                fprintf(stderr, "Unknown --serial= choice: %s\n", serialtype);
                 Usage(stderr, bstcMode);
             }
             argv++; --argc;
@@ -343,9 +361,19 @@ main(int argc, const char **argv)
             outputFiles = 1;
             quiet = 1;
             argv++; --argc;
+        } else if (!strcmp(argv[0], "-fprofile-generate")) {
+            gl_profile_generate = 1;
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "-fprofile-use=", 14)) {
+            gl_profile_use = strdup(argv[0]+14);
+            argv++; --argc;
         } else if (!strcmp(argv[0], "-q")) {
             quiet = 1;
             argv++; --argc;
+        } else if (!strcmp(argv[0], "-v")) {
+            // print statistics about optimizations
+            gl_printstats = 1;
+            argv++; --argc;
         } else if (!strcmp(argv[0], "-u")) {
             // ignore -u, we always eliminate unused methods
             argv++; --argc;
@@ -443,11 +471,17 @@ main(int argc, const char **argv)
             // -O0 means no optimization
             // -O1 means default optimization
             // -O2 means extra optimization
+            // -O3 means extra optimization, favoring speed over size
+            // -Os means extra optimization, favoring size over speed
             int flag = argv[0][2];
             if (flag == '0') {
                 gl_optimize_flags = 0;
             } else if (flag == '1') {
                 gl_optimize_flags = DEFAULT_ASM_OPTS;
+            } else if (flag == '3') {
+                gl_optimize_flags = DEFAULT_ASM_OPTS|EXTRA_ASM_OPTS|OPT_INLINE_AGGRESSIVE;
+            } else if (flag == 's') {
+                gl_optimize_flags = DEFAULT_ASM_OPTS|EXTRA_ASM_OPTS|OPT_OPTIMIZE_SIZE;
             } else {
                 gl_optimize_flags = DEFAULT_ASM_OPTS|EXTRA_ASM_OPTS;
             }
@@ -455,12 +489,16 @@ main(int argc, const char **argv)
         } else if (!strncmp(argv[0], "-z", 2)) {
             // -z0 means no compression (default)
             // -z1 means compress
+            // -zv means compress and print statistics
             // other z values reserved
             int flag = argv[0][2];
             if (flag == '0') {
                 gl_compress = 0;
             } else if (flag == '1' || flag == 0) {
                 gl_compress = 1;
+            } else if (flag == 'v') {
+                gl_compress = 1;
+                gl_printstats = 1;
             } else {
                 fprintf(stderr, "-z option %c is not supported\n", flag);
                 Usage(stderr, bstcMode);
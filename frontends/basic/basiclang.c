@@ -952,6 +952,301 @@ doBasicTransform(AST **astptr)
     }
 }
 
+/*
+ * string building: s$ = s$ + x, done over and over in a loop, makes a
+ * new copy of all of s$ every time and so takes time quadratic in the
+ * final length. For a local string which never has its address taken
+ * we keep a hidden variable holding its length plus 1 while s$ points
+ * to a buffer which nothing else can see, and turn such statements into
+ * calls to _string_append, which adds to the end of the buffer and
+ * doubles it when it is full. Any other use of s$ which might keep the
+ * pointer (assigning it somewhere, passing it to a function, returning
+ * it) sets the hidden variable to 0 first, so the next append copies
+ * the string into a new buffer instead of changing one that can be seen
+ * elsewhere. The buffers are ordinary garbage collected strings.
+ */
+typedef struct StringBuilder {
+    struct StringBuilder *next;
+    Symbol *sym;
+    AST *lenvar;     /* hidden length + 1, 0 if the buffer is not ours */
+    int appends;     /* number of s$ = s$ + ... statements */
+    int bad;         /* cannot be done for this variable */
+} StringBuilder;
+
+static StringBuilder *builders;
+
+/* returns the symbol if ast is a local string variable */
+static Symbol *
+LocalStringSym(AST *ast)
+{
+    Symbol *sym;
+
+    if (!ast || (ast->kind != AST_IDENTIFIER && ast->kind != AST_LOCAL_IDENTIFIER)) {
+        return NULL;
+    }
+    sym = LookupAstSymbol(ast, NULL);
+    if (!sym || (sym->kind != SYM_LOCALVAR && sym->kind != SYM_PARAMETER)) {
+        return NULL;
+    }
+    if (!IsStringType(ExprType(ast))) {
+        return NULL;
+    }
+    return sym;
+}
+
+static StringBuilder *
+FindStringBuilder(Symbol *sym, int create)
+{
+    StringBuilder *sb;
+
+    if (!sym) return NULL;
+    for (sb = builders; sb; sb = sb->next) {
+        if (sb->sym == sym) return sb;
+    }
+    if (!create) return NULL;
+    sb = (StringBuilder *)calloc(1, sizeof(*sb));
+    sb->sym = sym;
+    sb->next = builders;
+    builders = sb;
+    return sb;
+}
+
+static int
+MentionsSym(AST *ast, Symbol *sym)
+{
+    if (!ast) return 0;
+    if (ast->kind == AST_IDENTIFIER || ast->kind == AST_LOCAL_IDENTIFIER) {
+        return LookupAstSymbol(ast, NULL) == sym;
+    }
+    if (ast->kind == AST_METHODREF) {
+        return MentionsSym(ast->left, sym);
+    }
+    return MentionsSym(ast->left, sym) || MentionsSym(ast->right, sym);
+}
+
+/*
+ * if ast is s$ = s$ + x + ... (where the x's do not use s$) return the
+ * symbol for s$, and put the list of things to append in *parts
+ */
+static Symbol *
+AppendTarget(AST *ast, AST **parts)
+{
+    Symbol *sym;
+    AST *rhs;
+    AST *list = NULL;
+
+    if (ast->kind != AST_ASSIGN || ast->d.ival != K_ASSIGN) {
+        return NULL;
+    }
+    sym = LocalStringSym(ast->left);
+    if (!sym) return NULL;
+    rhs = ast->right;
+    if (!IsCallTo(rhs, "_string_concat")) {
+        return NULL;
+    }
+    while (IsCallTo(rhs, "_string_concat")) {
+        AST *args = rhs->right;
+        if (!args || !args->right || args->right->right) {
+            return NULL;
+        }
+        if (MentionsSym(args->right->left, sym)) {
+            return NULL;
+        }
+        list = NewAST(AST_EXPRLIST, args->right->left, list);
+        rhs = args->left;
+    }
+    if (LocalStringSym(rhs) != sym) {
+        return NULL;
+    }
+    *parts = list;
+    return sym;
+}
+
+/* find the variables we could build, and any which must not be */
+static void
+FindStringBuilders(AST *ast)
+{
+    StringBuilder *sb;
+    AST *parts;
+
+    if (!ast) return;
+    switch (ast->kind) {
+    case AST_IDENTIFIER:
+    case AST_LOCAL_IDENTIFIER:
+        return;
+    case AST_METHODREF:
+        FindStringBuilders(ast->left);
+        return;
+    case AST_ASSIGN:
+        sb = FindStringBuilder(AppendTarget(ast, &parts), 1);
+        if (sb) {
+            sb->appends++;
+            FindStringBuilders(parts);
+            return;
+        }
+        break;
+    case AST_ADDROF:
+    case AST_ABSADDROF:
+        sb = FindStringBuilder(LocalStringSym(ast->left), 1);
+        if (sb) {
+            sb->bad = 1;
+        }
+        break;
+    default:
+        break;
+    }
+    FindStringBuilders(ast->left);
+    FindStringBuilders(ast->right);
+}
+
+/*
+ * mark variables which are changed other than by a plain assignment
+ * (a multiple assignment, or writing to part of the string)
+ */
+static void
+CheckStringBuilderWrites(AST *ast)
+{
+    StringBuilder *sb;
+
+    if (!ast) return;
+    if (ast->kind == AST_ASSIGN && !LocalStringSym(ast->left)) {
+        for (sb = builders; sb; sb = sb->next) {
+            if (MentionsSym(ast->left, sb->sym)) {
+                sb->bad = 1;
+            }
+        }
+    }
+    CheckStringBuilderWrites(ast->left);
+    CheckStringBuilderWrites(ast->right);
+}
+
+static StringBuilder *
+UsableBuilder(AST *ast)
+{
+    StringBuilder *sb = FindStringBuilder(LocalStringSym(ast), 0);
+    if (sb && sb->lenvar) {
+        return sb;
+    }
+    return NULL;
+}
+
+static void
+BuildStringsIn(AST **astptr)
+{
+    AST *ast = *astptr;
+    StringBuilder *sb;
+    AST *parts;
+    AST *seq;
+    AST *args;
+
+    if (!ast) return;
+    switch (ast->kind) {
+    case AST_IDENTIFIER:
+    case AST_LOCAL_IDENTIFIER:
+        sb = UsableBuilder(ast);
+        if (sb) {
+            // the pointer may escape, so the buffer is no longer ours
+            *astptr = NewAST(AST_SEQUENCE, AstAssign(sb->lenvar, AstInteger(0)), ast);
+        }
+        return;
+    case AST_METHODREF:
+        BuildStringsIn(&ast->left);
+        return;
+    case AST_ASSIGN:
+        sb = FindStringBuilder(AppendTarget(ast, &parts), 0);
+        if (sb && sb->lenvar) {
+            seq = NULL;
+            while (parts) {
+                AST *call;
+                AST *dest;
+                AST *part;
+                const char *append = "_string_append";
+                BuildStringsIn(&parts->left);
+                part = parts->left;
+                if (IsCallTo(part, "chr$") && part->right && !part->right->right) {
+                    // append the character directly, rather than making
+                    // a string for it first
+                    append = "_string_appendc";
+                    part = part->right->left;
+                }
+                call = NewAST(AST_FUNCCALL, AstIdentifier(append),
+                              NewAST(AST_EXPRLIST, DupAST(ast->left),
+                                     NewAST(AST_EXPRLIST, DupAST(sb->lenvar),
+                                            NewAST(AST_EXPRLIST, part, NULL))));
+                dest = NewAST(AST_EXPRLIST, DupAST(ast->left),
+                              NewAST(AST_EXPRLIST, DupAST(sb->lenvar), NULL));
+                seq = AddToList(seq, NewAST(AST_SEQUENCE, AstAssign(dest, call), NULL));
+                parts = parts->right;
+            }
+            *astptr = seq;
+            return;
+        }
+        BuildStringsIn(&ast->right);
+        sb = UsableBuilder(ast->left);
+        if (sb) {
+            // a new value, which is not in one of our buffers
+            ast->right = NewAST(AST_SEQUENCE, AstAssign(sb->lenvar, AstInteger(0)), ast->right);
+        } else {
+            BuildStringsIn(&ast->left);
+        }
+        return;
+    case AST_ARRAYREF:
+        // reading a character does not let the pointer escape
+        if (!UsableBuilder(ast->left)) {
+            BuildStringsIn(&ast->left);
+        }
+        BuildStringsIn(&ast->right);
+        return;
+    case AST_FUNCCALL:
+        if (IsCallTo(ast, "__builtin_strlen") || IsCallTo(ast, "_string_cmp")
+            || IsCallTo(ast, "_basic_print_string"))
+        {
+            // these do not keep the pointers they are given
+            for (args = ast->right; args; args = args->right) {
+                if (!UsableBuilder(args->left)) {
+                    BuildStringsIn(&args->left);
+                }
+            }
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+    BuildStringsIn(&ast->left);
+    BuildStringsIn(&ast->right);
+}
+
+static void
+BuildStrings(Function *func)
+{
+    StringBuilder *sb;
+    AST *init = NULL;
+
+    if (func->closure) {
+        // locals may be used by other functions
+        return;
+    }
+    builders = NULL;
+    FindStringBuilders(func->body);
+    CheckStringBuilderWrites(func->body);
+    for (sb = builders; sb; sb = sb->next) {
+        if (sb->appends && !sb->bad) {
+            sb->lenvar = AstTempLocalVariable("_strlen_", ast_type_long);
+            init = AddToList(init, NewAST(AST_STMTLIST, AstAssign(sb->lenvar, AstInteger(0)), NULL));
+        }
+    }
+    if (init) {
+        BuildStringsIn(&func->body);
+        func->body = AddToList(init, func->body);
+    }
+    while (builders) {
+        sb = builders->next;
+        free(builders);
+        builders = sb;
+    }
+}
+
 void
 BasicTransform(Function *func)
 {
@@ -960,4 +1255,8 @@ BasicTransform(Function *func)
     SimplifyAssignments(&func->body);
     doBasicTransform(&func->body);
     CheckTypes(func->body);
+    if (gl_output == OUTPUT_ASM && (gl_optimize_flags & OPT_STRING_BUILDER)) {
+        BuildStrings(func);
+    }
+    StackTemporaries(func);
 }
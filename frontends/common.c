@@ -59,7 +59,13 @@ int gl_fixedreal = 0;
 unsigned int gl_hub_base = 0x400;
 int gl_no_coginit = 0;
 int gl_lmm_kind = LMM_KIND_ORIG;
+int gl_lmm_line_longs = 8;
+int gl_lmm_ways = 2;
+int gl_lmm_stats = 0;
 int gl_relocatable = 0;
+int gl_profile_generate = 0;
+const char *gl_profile_use = NULL;
+int gl_serial_buffered = 0;
 
 // bytes and words are unsigned by default, but longs are signed by default
 // this is confusing, and someday we should make all of these explicit
@@ -944,6 +950,64 @@ CheckVersion(const char *str)
     exit(1);
 }
 
+//
+// parse the argument of --lmm=; for lru this may be followed by
+// ",line=N,ways=N,stats"
+// returns 0 (after printing a message) if it is not valid
+//
+int
+ParseLmmOption(const char *lmmtype)
+{
+    const char *opts;
+    int n;
+
+    if (!strcmp(lmmtype, "orig")) {
+        gl_lmm_kind = LMM_KIND_ORIG;
+    } else if (!strcmp(lmmtype, "slow")) {
+        gl_lmm_kind = LMM_KIND_SLOW;
+        gl_fcache_size = 0;
+    } else if (!strcmp(lmmtype, "trace")) {
+        gl_lmm_kind = LMM_KIND_TRACE;
+    } else if (!strcmp(lmmtype, "cache")) {
+        gl_lmm_kind = LMM_KIND_CACHE;
+    } else if (!strncmp(lmmtype, "lru", 3) && (lmmtype[3] == 0 || lmmtype[3] == ',')) {
+        gl_lmm_kind = LMM_KIND_LRU;
+        opts = lmmtype + 3;
+        while (*opts == ',') {
+            opts++;
+            if (!strncmp(opts, "line=", 5)) {
+                n = atoi(opts+5);
+                if (n < 4 || n > 64 || (n & (n-1)) != 0) {
+                    fprintf(stderr, "--lmm=lru line size must be 4, 8, 16, 32, or 64\n");
+                    return 0;
+                }
+                gl_lmm_line_longs = n;
+            } else if (!strncmp(opts, "ways=", 5)) {
+                n = atoi(opts+5);
+                if (n < 1 || n > 16) {
+                    fprintf(stderr, "--lmm=lru ways must be between 1 and 16\n");
+                    return 0;
+                }
+                gl_lmm_ways = n;
+            } else if (!strncmp(opts, "stats", 5) && (opts[5] == 0 || opts[5] == ',')) {
+                gl_lmm_stats = 1;
+            } else {
+                fprintf(stderr, "Unknown --lmm=lru option: %s\n", opts);
+                return 0;
+            }
+            while (*opts && *opts != ',') opts++;
+        }
+        if (*opts) {
+            fprintf(stderr, "Unknown --lmm=lru option: %s\n", opts);
+            return 0;
+        }
+    } else {
+        fprintf(stderr, "Unknown --lmm= choice: %s\n", lmmtype);
+        return 0;
+    }
+    return 1;
+}
+
 AST *
 NewCommentedInstr(AST *instr)
 {
@@ -1578,3 +1642,82 @@ DeclareMemberVariables(Module *P)
         P->pendingvarblock = NULL;
     }
 }
+
+/*
+ * assign new offsets to the member variables of a Spin module,
+ * skipping any marked with SYMF_NOALLOC; this follows the same
+ * rules as DeclareMemberVariables above
+ */
+static int
+RelayoutMemberVariablesOfSize(Module *P, int basetypesize, int offset)
+{
+    AST *upper;
+    AST *ast;
+    AST *idlist;
+    AST *ident;
+    Symbol *sym;
+    int curtypesize;
+
+    for (upper = P->finalvarblock; upper; upper = upper->right) {
+        ast = upper->left;
+        if (ast->kind == AST_COMMENTEDNODE)
+            ast = ast->left;
+        switch (ast->kind) {
+        case AST_BYTELIST:
+            curtypesize = 1;
+            idlist = ast->left;
+            break;
+        case AST_WORDLIST:
+            curtypesize = 2;
+            idlist = ast->left;
+            break;
+        case AST_LONGLIST:
+            curtypesize = 4;
+            idlist = ast->left;
+            break;
+        case AST_DECLARE_VAR:
+        case AST_DECLARE_VAR_WEAK:
+            curtypesize = TypeSize(ast->left);
+            idlist = ast->right;
+            break;
+        default:
+            continue;
+        }
+        if (!(basetypesize == curtypesize || (basetypesize == 4 && (curtypesize >= 4 || curtypesize == 0)))) {
+            continue;
+        }
+        for (; idlist; idlist = idlist->right) {
+            ident = idlist->left;
+            if (ident && ident->kind == AST_DECLARE_VAR) {
+                ident = ident->right;
+            }
+            while (ident && ident->kind == AST_ARRAYDECL) {
+                ident = ident->left;
+            }
+            if (!ident || !IsIdentifier(ident)) {
+                continue;
+            }
+            sym = FindSymbol(&P->objsyms, GetIdentifierName(ident));
+            if (!sym || sym->kind != SYM_VARIABLE || (sym->flags & SYMF_NOALLOC)) {
+                continue;
+            }
+            sym->offset = offset;
+            offset += sym->val ? TypeSize((AST *)sym->val) : 4;
+        }
+    }
+    return offset;
+}
+
+void
+RelayoutMemberVariables(Module *P)
+{
+    int offset = 0;
+
+    if (P->isUnion || !IsSpinLang(P->mainLanguage)) {
+        return;
+    }
+    offset = RelayoutMemberVariablesOfSize(P, 4, offset);
+    offset = RelayoutMemberVariablesOfSize(P, 2, offset);
+    offset = RelayoutMemberVariablesOfSize(P, 1, offset);
+    P->varsize = (offset + 3) & ~3;
+}
@@ -125,17 +125,29 @@ extern int gl_optimize_flags; /* flags for optimization */
 #define OPT_INLINE_SMALLFUNCS   0x10  /* inline small functions */
 #define OPT_INLINE_SINGLEUSE    0x20  /* inline single use functions */
 #define OPT_AUTO_FCACHE         0x40  /* use FCACHE for P2 */
-
-#define DEFAULT_ASM_OPTS        (OPT_REMOVE_UNUSED_FUNCS|OPT_INLINE_SMALLFUNCS|OPT_BASIC_ASM)
-#define EXTRA_ASM_OPTS          (OPT_INLINE_SINGLEUSE|OPT_PERFORM_CSE|OPT_REMOVE_HUB_BSS|OPT_AUTO_FCACHE) /* extras added with -O2 */
+#define OPT_HUB_FIFO            0x80  /* use P2 hub FIFO for sequential loops */
+#define OPT_AUTO_PLACE          0x100 /* put frequently called functions in LUT on P2 */
+#define OPT_SPECIALIZE          0x200 /* specialize functions for constant arguments */
+#define OPT_REMOVE_UNUSED_DATA  0x400 /* remove unused member variables, DAT, and strings */
+#define OPT_MERGE_STRINGS       0x800 /* share memory between identical strings and string suffixes */
+#define OPT_OPTIMIZE_SIZE       0x1000 /* never let inlining or cloning make the program bigger (-Os) */
+#define OPT_INLINE_AGGRESSIVE   0x2000 /* bigger inlining budget (-O3) */
+#define OPT_HUB_SCHEDULE        0x4000 /* schedule instructions around hub accesses */
+#define OPT_STRING_BUILDER      0x8000 /* append to BASIC strings in place where it is safe */
+#define OPT_STACK_TEMPS         0x10000 /* put temporary strings and method pointers on the stack when they cannot escape */
+
+#define DEFAULT_ASM_OPTS        (OPT_REMOVE_UNUSED_FUNCS|OPT_INLINE_SMALLFUNCS|OPT_BASIC_ASM|OPT_STRING_BUILDER|OPT_STACK_TEMPS)
+#define EXTRA_ASM_OPTS          (OPT_INLINE_SINGLEUSE|OPT_PERFORM_CSE|OPT_REMOVE_HUB_BSS|OPT_AUTO_FCACHE|OPT_HUB_FIFO|OPT_AUTO_PLACE|OPT_SPECIALIZE|OPT_REMOVE_UNUSED_DATA|OPT_MERGE_STRINGS|OPT_HUB_SCHEDULE) /* extras added with -O2 */
 
 extern int gl_printprogress;  /* print files as we process them */
 extern int gl_fcache_size;   /* size of fcache for LMM mode */
+extern int gl_cogplace_size; /* longs of COG memory to fill with frequently called functions */
 extern const char *gl_cc; /* C compiler to use; NULL means default (PropGCC) */
 extern const char *gl_intstring; /* int string to use */
 
 extern int gl_dat_offset; /* offset for @@@ operator */
-extern int gl_compress;   /* if instructions should be compressed (NOT IMPLEMENTED) */
+extern int gl_compress;   /* if P1 hub code should be compressed into byte codes (-z) */
+extern int gl_printstats; /* print statistics about compressed code and pooled strings */
 extern int gl_fixedreal;  /* if instead of float we should use 16.16 fixed point */
 #define G_FIXPOINT 16  /* number of bits of fraction */
 
@@ -145,6 +157,11 @@ extern int gl_no_coginit;    /* skip coginit code */
 extern int gl_exit_status;   /* after exit return exit code via special sequence */
 extern int gl_relocatable;   /* 1 for position independent output */
 
+extern int gl_profile_generate;    /* if set, add code to count function calls, loops, and branches */
+extern const char *gl_profile_use; /* file of counts to guide optimization, or NULL */
+
+extern int gl_serial_buffered;     /* if set, a helper cog does the console serial I/O */
+
 /* LMM kind selected */
 extern int gl_lmm_kind;
 #define LMM_KIND_ORIG  0
@@ -152,6 +169,12 @@ extern int gl_lmm_kind;
 #define LMM_KIND_TRACE 2
 #define LMM_KIND_CACHE 3
 #define LMM_KIND_COMPRESS 4
+#define LMM_KIND_LRU   5
+
+/* geometry of the --lmm=lru cache */
+extern int gl_lmm_line_longs;  /* instructions per cache line */
+extern int gl_lmm_ways;        /* lines per set */
+extern int gl_lmm_stats;       /* if set, print hit counts at exit */
 
 /* types of output */
 #define OUTPUT_CPP  0
@@ -267,6 +290,7 @@ typedef struct funcdef {
     unsigned used_as_ptr:1;  // 1 if function's address is taken as a pointer
     unsigned local_address_taken: 1; // 1 if a local variable or parameter has its address taken
     unsigned no_inline:1;    // 1 if function cannot be inlined
+    unsigned prefer_inline:1; // 1 if function was declared {++inline}
     unsigned is_leaf:1;      // 1 if function is a leaf function
     unsigned uses_alloca:1;  // 1 if function uses alloca
     unsigned stack_local:1;  // 1 if function has a local that must go on stack
@@ -292,6 +316,9 @@ typedef struct funcdef {
     /* language of this function */
     int language;
 
+    /* counts from the profile given with -fprofile-use, if any */
+    struct ProfileSite *profile;
+
     /* true if language specific processing has been done */
     char lang_processed;
     
@@ -366,6 +393,7 @@ struct modulestate {
     /* flags for output */
     char pasmLabels;
     char volatileVariables;
+    char sharedVariables; // if 1, variables are copied to/from another COG with longmove
     char sawToken;
     char codeCog; // if 1, module should be placed in COG memory
     char datHasCode; // if 1, DAT section has PASM code in it
@@ -618,6 +646,9 @@ char *ReplaceDirectory(const char *basename, const char *directory);
 // of the given size
 int DoPropellerChecksum(const char *fname, size_t eepromSize);
 
+// parse the argument of --lmm=; returns 0 if it is not valid
+int ParseLmmOption(const char *lmmtype);
+
 // initialization functions
 void Init();
 void InitPreprocessor(const char *argv[]);
@@ -627,9 +658,26 @@ void SetPreprocessorLanguage(int language);
 void PerformCSE(Module *P);
 void PerformLoopOptimization(Module *P);
 
+// profile guided optimization
+void ProfileModule(Module *P);
+void ProfileFinish(void);
+int ProfileFunctionHeat(Function *f);
+int ProfileFunctionCalls(Function *f);
+int ProfileColdBranch(Function *f, AST *ifstmt);
+bool ProfileFewIterations(Function *f, AST *loop);
+
+// substitute constant arguments into functions
+void SpecializeFunctions(int isBinary);
+
 // simplify statments like a^=b to a = a^b
 void SimplifyAssignments(AST **astptr);
 
+// check for a call to the system function name (or an alias for it)
+int IsCallTo(AST *ast, const char *name);
+
+// put temporaries which cannot escape in the stack frame
+void StackTemporaries(Function *func);
+
 extern unsigned int gl_hub_base;
 #define P2_HUB_BASE gl_hub_base
 #define P2_CONFIG_BASE 0x10   /* clkfreq and such go here */
@@ -737,6 +785,9 @@ void AddSubClass(Module *P, Module *subP);
 /* declare all member variables in a module */
 void DeclareMemberVariables(Module *);
 
+/* recompute member variable offsets after unused ones are removed */
+void RelayoutMemberVariables(Module *);
+
 /* declare some global variables; if inDat is true, put them in
  * DAT, otherwise make them member variables
  */
@@ -2529,8 +2529,8 @@ instr_p2[] = {
     { "muxq",   0x09f00000, TWO_OPERANDS, OPC_GENERIC, 0 },
     { "movbyts", 0x09f80000, TWO_OPERANDS, OPC_GENERIC, 0 },
 
-    { "mul",    0x0a000000, TWO_OPERANDS, OPC_GENERIC, FLAG_WZ },
-    { "muls",   0x0a100000, TWO_OPERANDS, OPC_GENERIC, FLAG_WZ },
+    { "mul",    0x0a000000, TWO_OPERANDS, OPC_MUL, FLAG_WZ },
+    { "muls",   0x0a100000, TWO_OPERANDS, OPC_MULS, FLAG_WZ },
     { "sca",    0x0a200000, TWO_OPERANDS, OPC_GENERIC, FLAG_WZ },
     { "scas",   0x0a300000, TWO_OPERANDS, OPC_GENERIC, FLAG_WZ },
 
@@ -2636,8 +2636,8 @@ instr_p2[] = {
     { "pusha",  0x0c600161, TWO_OPERANDS_DEFZ, OPC_GENERIC, 0 },
     { "pushb",  0x0c6001e1, TWO_OPERANDS_DEFZ, OPC_GENERIC, 0 },
 
-    { "rdfast", 0x0c700000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
-    { "wrfast", 0x0c800000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
+    { "rdfast", 0x0c700000, P2_TWO_OPERANDS, OPC_RDFAST, 0 },
+    { "wrfast", 0x0c800000, P2_TWO_OPERANDS, OPC_WRFAST, 0 },
     { "fblock", 0x0c900000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
 
     { "xinit",  0x0ca00000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
@@ -2648,8 +2648,8 @@ instr_p2[] = {
     { "rep",    0x0cd00000, P2_TWO_OPERANDS, OPC_REPEAT, 0 },
   
     { "coginit",0x0ce00000, P2_TWO_OPERANDS, OPC_GENERIC, FLAG_WC },
-    { "qmul",   0x0d000000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
-    { "qdiv",   0x0d100000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
+    { "qmul",   0x0d000000, P2_TWO_OPERANDS, OPC_QMUL, 0 },
+    { "qdiv",   0x0d100000, P2_TWO_OPERANDS, OPC_QDIV, 0 },
     { "qfrac",  0x0d200000, P2_TWO_OPERANDS, OPC_QFRAC, 0 },
     { "qsqrt",  0x0d300000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
     { "qrotate",0x0d400000, P2_TWO_OPERANDS, OPC_GENERIC, 0 },
@@ -2666,15 +2666,15 @@ instr_p2[] = {
     { "qlog",   0x0d60000e, P2_DST_CONST_OK, OPC_GENERIC, 0 },
     { "qexp",   0x0d60000f, P2_DST_CONST_OK, OPC_GENERIC, 0 },
   
-    { "rfbyte", 0x0d600010, DST_OPERAND_ONLY, OPC_GENERIC, FLAG_P2_STD },
-    { "rfword", 0x0d600011, DST_OPERAND_ONLY, OPC_GENERIC, FLAG_P2_STD },
-    { "rflong", 0x0d600012, DST_OPERAND_ONLY, OPC_GENERIC, FLAG_P2_STD },
+    { "rfbyte", 0x0d600010, DST_OPERAND_ONLY, OPC_RFBYTE, FLAG_P2_STD },
+    { "rfword", 0x0d600011, DST_OPERAND_ONLY, OPC_RFWORD, FLAG_P2_STD },
+    { "rflong", 0x0d600012, DST_OPERAND_ONLY, OPC_RFLONG, FLAG_P2_STD },
     { "rfvar",  0x0d600013, DST_OPERAND_ONLY, OPC_GENERIC, FLAG_P2_STD },
     { "rfvars", 0x0d600014, DST_OPERAND_ONLY, OPC_GENERIC, FLAG_P2_STD },
     
-    { "wfbyte", 0x0d600015, P2_DST_CONST_OK, OPC_GENERIC, 0 },
-    { "wfword", 0x0d600016, P2_DST_CONST_OK, OPC_GENERIC, 0 },
-    { "wflong", 0x0d600017, P2_DST_CONST_OK, OPC_GENERIC, 0 },
+    { "wfbyte", 0x0d600015, P2_DST_CONST_OK, OPC_WFBYTE, 0 },
+    { "wfword", 0x0d600016, P2_DST_CONST_OK, OPC_WFWORD, 0 },
+    { "wflong", 0x0d600017, P2_DST_CONST_OK, OPC_WFLONG, 0 },
 
     { "getqx",  0x0d600018, DST_OPERAND_ONLY, OPC_GETQX, FLAG_P2_STD },
     { "getqy",  0x0d600019, DST_OPERAND_ONLY, OPC_GETQY, FLAG_P2_STD },
@@ -153,6 +153,7 @@ TransformLongMove(AST **astptr, AST *ast)
     /* the longmove probably indicates a COG will be reading these
        variables */
     current->volatileVariables = 1;
+    current->sharedVariables = 1;
     AstReportDone(&saveinfo);
     return true;
 }
@@ -747,6 +748,9 @@ SpinTransform(Function *func)
     /* check for special conditions */
     ScanFunctionBody(func, func->body, NULL, NULL);
 
+    /* temporaries which do not escape may go on the stack */
+    StackTemporaries(func);
+
     /* if we put the locals into an array, record the size of that array */
     if (func->localarray) {
         func->localarray_len += func->numlocals;
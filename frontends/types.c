@@ -1529,6 +1529,18 @@ InitGlobalFuncs(void)
             float_neg = getBasicPrimitive("_float_negate");
             float_pow_n = getBasicPrimitive("_float_pow_n");
             float_powf = getBasicPrimitive("__builtin_powf");
+            if (gl_p2) {
+                // faster versions which use the CORDIC
+                float_div = getBasicPrimitive("_float_fastdiv");
+                float_sqrt = getBasicPrimitive("_float_fastsqrt");
+                if (!(gl_optimize_flags & OPT_OPTIMIZE_SIZE)) {
+                    // these have a fast path which is inlined
+                    float_cmp = getBasicPrimitive("_float_fastcmp");
+                    float_add = getBasicPrimitive("_float_fastadd");
+                    float_sub = getBasicPrimitive("_float_fastsub");
+                    float_mul = getBasicPrimitive("_float_fastmul");
+                }
+            }
         }
         basic_get_integer = getBasicPrimitive("_basic_get_integer");
         basic_get_string = getBasicPrimitive("_basic_get_string");
@@ -822,6 +822,13 @@ doDeclareFunction(AST *funcblock)
     fdef->name = funcname_internal;
     fdef->user_name = funcname_user;
     fdef->annotations = annotation;
+    if (annotation && annotation->kind == AST_ANNOTATION
+        && !strcmp(annotation->d.string, "inline"))
+    {
+        // the C backend just prints the annotation; the assembly
+        // backend inlines the function wherever it can
+        fdef->prefer_inline = 1;
+    }
     fdef->decl = funcdef;
     fdef->language = language;
     if (comment) {
@@ -2688,6 +2695,182 @@ SimplifyAssignments(AST **astptr)
     SimplifyAssignments(&ast->right);
 }
 
+int
+IsCallTo(AST *ast, const char *name)
+{
+    Symbol *sym;
+    const char *called;
+
+    if (!ast || ast->kind != AST_FUNCCALL || !ast->left || ast->left->kind != AST_IDENTIFIER) {
+        return 0;
+    }
+    called = ast->left->d.string;
+    sym = LookupSymbol(called);
+    if (sym) {
+        if (sym->kind == SYM_WEAK_ALIAS) {
+            // len is an alias for __builtin_strlen, for example
+            called = (const char *)sym->val;
+        } else if (sym->kind == SYM_FUNCTION && ((Function *)sym->val)->module != globalModule) {
+            // the user's own function of the same name
+            return 0;
+        } else {
+            called = sym->our_name;
+        }
+    }
+    return !strcasecmp(called, name);
+}
+
+/*
+ * temporary strings and method pointers which are only passed straight
+ * to a function known not to keep them (like PRINT, or string
+ * concatenation, which copies its operands) do not need to go on the
+ * heap. A function with any of them gets a scratch area in its stack
+ * frame, allocated once on entry; the temporaries in a statement use
+ * separate parts of it, and the next statement uses it again. The area
+ * is kept small, since recursive functions and cogs with small stacks
+ * pay for it on every call; temporaries which do not fit go on the heap
+ */
+#define STACKTEMP_MAX 64
+
+static struct {
+    const char *name;    /* function making a temporary */
+    const char *inname;  /* version which takes (buf, size, ...) */
+    int size;            /* bytes to reserve for it */
+    int base;            /* for the number$ functions, the base */
+} stacktemps[] = {
+    { "_make_methodptr", "_make_methodptr_in", 8, 0 },
+    { "_string_concat", "_string_concat_in", 32, 0 },
+    { "chr$", "_chr_in", 4, 0 },
+    { "str$", "_str_in", 16, 0 },
+    { "hex$", "_number_in", 12, 16 },
+    { "decuns$", "_number_in", 12, 10 },
+    { "oct$", "_number_in", 12, 8 },
+    { "bin$", "_number_in", 36, 2 },
+};
+
+/* functions which do not keep the pointers passed in arguments first..last */
+static struct {
+    const char *name;
+    int first;
+    int last;
+} tempsinks[] = {
+    { "_basic_print_string", 2, 2 },
+    { "_string_concat", 1, 2 },
+    { "_string_concat_in", 3, 4 },
+    { "_string_append", 3, 3 },
+    { "_string_cmp", 1, 2 },
+    { "_funcptr_cmp", 1, 2 },
+    { "__builtin_strlen", 1, 1 },
+    { "__sendstring", 1, 2 },
+    { "_fmtchar", 1, 1 },
+    { "_fmtstr", 1, 3 },
+    { "_fmtnum", 1, 1 },
+    { "_fmtfloat", 1, 1 },
+};
+
+static AST *stacktemp_buf;
+
+static void StackTempsInList(AST *list, int *maxsize);
+
+static void
+StackTempsIn(AST *ast, int *offset, int *maxsize)
+{
+    AST *args;
+    AST *arg;
+    int i, n;
+    int first = 0, last = -1;
+
+    if (!ast) return;
+    if (ast->kind == AST_STMTLIST) {
+        StackTempsInList(ast, maxsize);
+        return;
+    }
+    if (ast->kind == AST_FUNCCALL) {
+        for (i = 0; i < (int)(sizeof(tempsinks)/sizeof(tempsinks[0])); i++) {
+            if (IsCallTo(ast, tempsinks[i].name)) {
+                first = tempsinks[i].first;
+                last = tempsinks[i].last;
+                break;
+            }
+        }
+        for (args = ast->right, n = 1; args; args = args->right, n++) {
+            arg = args->left;
+            if (n < first || n > last || !arg || arg->kind != AST_FUNCCALL) {
+                continue;
+            }
+            for (i = 0; i < (int)(sizeof(stacktemps)/sizeof(stacktemps[0])); i++) {
+                if (IsCallTo(arg, stacktemps[i].name)) {
+                    break;
+                }
+            }
+            if (i == (int)(sizeof(stacktemps)/sizeof(stacktemps[0]))) {
+                continue;
+            }
+            if (*offset + stacktemps[i].size > STACKTEMP_MAX) {
+                continue;
+            }
+            if (!stacktemp_buf) {
+                stacktemp_buf = AstTempLocalVariable("_stacktmp_", ast_type_ptr_byte);
+            }
+            if (stacktemps[i].base) {
+                // number$(val, n, base); n defaults to 0
+                AST *params = arg->right;
+                if (!params || !params->left) {
+                    continue;
+                }
+                if (!params->right) {
+                    params->right = NewAST(AST_EXPRLIST, AstInteger(0), NULL);
+                }
+                params->right->right = NewAST(AST_EXPRLIST, AstInteger(stacktemps[i].base), NULL);
+            }
+            arg->left = AstIdentifier(stacktemps[i].inname);
+            arg->right = NewAST(AST_EXPRLIST,
+                                AstOperator('+', DupAST(stacktemp_buf), AstInteger(*offset)),
+                                NewAST(AST_EXPRLIST, AstInteger(stacktemps[i].size),
+                                       arg->right));
+            *offset += stacktemps[i].size;
+        }
+    }
+    StackTempsIn(ast->left, offset, maxsize);
+    StackTempsIn(ast->right, offset, maxsize);
+}
+
+static void
+StackTempsInList(AST *list, int *maxsize)
+{
+    int offset;
+
+    while (list && list->kind == AST_STMTLIST) {
+        offset = 0;
+        StackTempsIn(list->left, &offset, maxsize);
+        if (offset > *maxsize) {
+            *maxsize = offset;
+        }
+        list = list->right;
+    }
+}
+
+void
+StackTemporaries(Function *func)
+{
+    int size = 0;
+    AST *alloc;
+
+    if (gl_output != OUTPUT_ASM || !(gl_optimize_flags & OPT_STACK_TEMPS)) {
+        return;
+    }
+    if (func->cog_code || !func->body || func->body->kind != AST_STMTLIST) {
+        return;
+    }
+    stacktemp_buf = NULL;
+    StackTempsInList(func->body, &size);
+    if (stacktemp_buf) {
+        alloc = AstAssign(stacktemp_buf, NewAST(AST_ALLOCA, ast_type_ptr_byte, AstInteger(size)));
+        func->body = NewAST(AST_STMTLIST, alloc, func->body);
+        func->uses_alloca = 1;
+    }
+}
+
 void
 DeclareFunctionTemplate(Module *P, AST *templ)
 {
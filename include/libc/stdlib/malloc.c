@@ -15,18 +15,5 @@ void free(void *ptr) {
 
 void *realloc(void *ptr, size_t size)
 {
-    void *newptr;
-    if (ptr == 0) {
-        return malloc(size);
-    }
-    if (size == 0) {
-        free(ptr);
-        return 0;
-    }
-    newptr = malloc(size);
-    if (newptr) {
-        memcpy(newptr, ptr, size);
-        free(ptr);
-    }
-    return newptr;
+    return _gc_realloc(ptr, size);
 }
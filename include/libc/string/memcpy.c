@@ -22,6 +22,10 @@ memcpy(void *dest_p, const void *src_p, size_t n)
 {
   void *orig_dest = dest_p;
 
+#ifdef __P2__
+  /* the system bytemove uses burst transfers through the LUT */
+  bytemove(dest_p, src_p, n);
+#else
 #if defined(__PROPELLER_USE_XMM__)
   extern void *_copy_from_xmm(void *dest, const void *src, size_t n);
   if (HUBMEM(dest_p) && !HUBMEM(src_p))
@@ -55,6 +59,7 @@ memcpy(void *dest_p, const void *src_p, size_t n)
     }
   }
 
+#endif
   return orig_dest;
 }
 
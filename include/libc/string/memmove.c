@@ -20,6 +20,10 @@ memmove(void *dest_p, const void *src_p, size_t n)
   const char *src = src_p;
   char *dst = dest_p;
 
+#ifdef __P2__
+  /* the system bytemove handles overlapping regions */
+  bytemove(dest_p, src_p, n);
+#else
   if ( (unsigned long)dst < (unsigned long)src )
     {
       while (n > 0) {
@@ -40,6 +44,7 @@ memmove(void *dest_p, const void *src_p, size_t n)
       }
     }
 
+#endif
   return orig_dest;
 }
 
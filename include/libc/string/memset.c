@@ -22,6 +22,9 @@ memset(void *dest_p, int c, size_t n)
   void *orig_dest = dest_p;
   char *dst;
 
+#ifdef __P2__
+  bytefill(dest_p, c, n);
+#else
   /* fill with longs if applicable */
   if (ALIGNED(dest_p) && n > sizeof(uint32_t))
     {
@@ -43,6 +46,7 @@ memset(void *dest_p, int c, size_t n)
     --n;
   }
 
+#endif
   return orig_dest;
 }
 
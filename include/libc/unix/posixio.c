@@ -31,6 +31,13 @@ static int __dummy_flush(vfs_file_t *f)
 // BASIC support routines
 extern int _tx(int c);
 extern int _rx(void);
+extern int _txbuf(const void *ptr, int n);
+
+// the console sends whole buffers at once with _txbuf
+static ssize_t _rxtxwrite(vfs_file_t *f, const void *buf, size_t n)
+{
+    return _txbuf(buf, n);
+}
 
 static vfs_file_t __filetab[_MAX_FILES] = {
     /* stdin */
@@ -39,7 +46,7 @@ static vfs_file_t __filetab[_MAX_FILES] = {
         O_RDONLY, /* flags */
         _VFS_STATE_INUSE|_VFS_STATE_RDOK, /* state */
         0, /* read */
-        0, /* write */
+        &_rxtxwrite, /* write */
         (putcfunc_t)&_tx, /* putc */
         (getcfunc_t)&_rx, /* getc */
         0, /* close function */
@@ -52,7 +59,7 @@ static vfs_file_t __filetab[_MAX_FILES] = {
         O_WRONLY, /* flags */
         _VFS_STATE_INUSE|_VFS_STATE_WROK,
         0, /* read */
-        0, /* write */
+        &_rxtxwrite, /* write */
         (putcfunc_t)&_tx, /* putchar */
         (getcfunc_t)&_rx, /* getchar */
         0, /* close function */
@@ -65,7 +72,7 @@ static vfs_file_t __filetab[_MAX_FILES] = {
         O_WRONLY, /* flags */
         _VFS_STATE_INUSE|_VFS_STATE_WROK,
         0, /* read */
-        0, /* write */
+        &_rxtxwrite, /* write */
         (putcfunc_t)&_tx, /* putchar */
         (getcfunc_t)&_rx, /* getchar */
         0, /* close function */
@@ -16,6 +16,12 @@
 #include "math.h"
 #include "math_private.h"
 
+#ifdef __P2__
+/* the P2 version at the end of this file uses the CORDIC, and
+   falls back to this one for the cases it does not handle */
+#define __builtin_expf _expf_generic
+#endif
+
 static const volatile float huge = 1.0e+30;
 
 static const float
@@ -92,3 +98,52 @@ __builtin_expf(float x)	/* default IEEE double exp */
 	    return y*twom100;
 	}
 }
+
+#ifdef __P2__
+#undef __builtin_expf
+
+#define LOG2E_FIX 0xB8AA3B29	/* log2(e) * 2^31 */
+
+/*
+ * exp(x) = 2^(x*log2(e)): split x*log2(e) into an integer n and a 5.27
+ * fixed point fraction f, and let the CORDIC compute 2^f
+ * within 1 ulp for |x| <= 87; larger values go to the generic code
+ */
+float
+__builtin_expf(float x)
+{
+	uint32_t ix, m, k, hi, lo, n, f, r;
+	int32_t e;
+
+	GET_FLOAT_WORD(ix,x);
+	if ((ix&0x7fffffff) > 0x42ae0000)	/* |x| > 87, inf, or NaN */
+	    return _expf_generic(x);
+	e = ((ix>>23)&0xff)-127;
+	if (e < -24) return one+x;
+	m = (ix&0x7fffff)|0x800000;
+	k = LOG2E_FIX;
+	__asm {
+	    qmul m, k
+	    getqx lo
+	    getqy hi
+	}
+	n = (e > -10) ? SHR64(hi,lo,54-e) : 0;
+	f = SHR64(hi,lo,27-e)&0x7ffffff;
+	if (ix>>31) {
+	    if (f) {
+		n = -n-1;
+		f = 0x8000000-f;
+	    } else {
+		n = -n;
+	    }
+	}
+	f |= 31<<27;
+	__asm {
+	    qexp f
+	    getqx r
+	}
+	r = ((r>>7)+1)>>1;			/* round to 23 bits */
+	SET_FLOAT_WORD(x,((n+126)<<23)+r);	/* r includes the leading 1 */
+	return x;
+}
+#endif
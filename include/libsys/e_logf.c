@@ -16,6 +16,12 @@
 #include "math.h"
 #include "math_private.h"
 
+#ifdef __P2__
+/* the P2 version at the end of this file uses the CORDIC, and
+   falls back to this one for the cases it does not handle */
+#define __builtin_logf _logf_generic
+#endif
+
 static const float
 ln2_hi =   6.9313812256e-01,	/* 0x3f317180 */
 ln2_lo =   9.0580006145e-06,	/* 0x3717f7d1 */
@@ -83,3 +89,43 @@ __builtin_logf(float x)
 #if defined(__SHORT_DOUBLES_IMPL)
 __strong_alias(log,logf);
 #endif
+
+#ifdef __P2__
+#undef __builtin_logf
+
+#define LN2 6.9314718056e-01f
+
+/*
+ * log(x) = (e + log2(m)) * ln2, with log2(m) from the CORDIC; m is kept
+ * between sqrt(2)/2 and sqrt(2) so that log2(m) is small, and near x = 1
+ * a series is used instead
+ * within 2 ulp; zero, negative, denormal, and infinite or NaN arguments
+ * go to the generic code
+ */
+float
+__builtin_logf(float x)
+{
+	uint32_t ix, m, q;
+	int32_t e;
+	float u;
+
+	GET_FLOAT_WORD(ix,x);
+	if (ix >= 0x7f800000 || ix < 0x00800000)
+	    return _logf_generic(x);
+	u = x-(float)1.0;
+	if (u < (float)0.0625 && u > -(float)0.0625) {
+	    return u*((float)1.0-u*((float)0.5-u*((float)(1.0/3.0)-u*((float)0.25-u*((float)0.2-u*(float)(1.0/6.0))))));
+	}
+	e = (ix>>23)-127;
+	m = ((ix&0x7fffff)|0x800000)<<8;
+	if (m > 0xB504F334u) {			/* m > sqrt(2) */
+	    e++;
+	    m >>= 1;
+	}
+	__asm {
+	    qlog m
+	    getqx q
+	}
+	return ((float)e + (int32_t)(q-(31<<27))*(float)(1.0/134217728.0))*LN2;
+}
+#endif
@@ -16,6 +16,12 @@
 #include "math.h"
 #include "math_private.h"
 
+#ifdef __P2__
+/* the P2 version at the end of this file uses the CORDIC, and
+   falls back to this one for the cases it does not handle */
+#define __builtin_powf _powf_generic
+#endif
+
 static const volatile float huge = 1.0e+30, tiny = 1.0e-30;
 
 static const float
@@ -243,3 +249,84 @@ __builtin_powf(float x, float y)
 #if defined(__SHORT_DOUBLES_IMPL)
 __strong_alias(pow,powf);
 #endif
+
+#ifdef __P2__
+#undef __builtin_powf
+
+/*
+ * x^y = 2^(y*log2(x)), with both the logarithm and the exponential
+ * from the CORDIC; y*log2(x) is kept to 64 bits
+ * within 2 ulp for |y| < 8, with the error growing to about 6 ulp as
+ * |y| approaches 64; x <= 0, |y| >= 64, zero or denormal y, infinities,
+ * NaNs, and results that would overflow or underflow go to the
+ * generic code
+ */
+float
+__builtin_powf(float x, float y)
+{
+	uint32_t ix, iy, m, my, q, d, hi, lo, ph, pl, n, f, r;
+	int32_t ex, ey, neg;
+
+	GET_FLOAT_WORD(ix,x);
+	GET_FLOAT_WORD(iy,y);
+	ey = ((iy>>23)&0xff)-127;
+	if (ix >= 0x7f800000 || ix < 0x00800000 || ey >= 6 || ey < -30)
+	    return _powf_generic(x,y);
+	my = (iy&0x7fffff)|0x800000;
+	ex = (ix>>23)-127;
+	m = ((ix&0x7fffff)|0x800000)<<8;
+	if (m > 0xB504F334u) {			/* m > sqrt(2) */
+	    ex++;
+	    m >>= 1;
+	}
+	__asm {
+	    qlog m
+	    getqx q
+	}
+	/* |log2(x)| = |ex| + |log2(m)| or |ex| - |log2(m)|, in 37.27 fixed point */
+	d = q-(31<<27);
+	neg = (ex < 0) || (ex == 0 && (int32_t)d < 0);
+	if (ex < 0) ex = -ex;
+	hi = ex>>5;
+	lo = ex<<27;
+	if (neg == ((int32_t)d < 0)) {
+	    if ((int32_t)d < 0) d = -d;
+	    lo += d;
+	    if (lo < d) hi++;
+	} else {
+	    if ((int32_t)d < 0) d = -d;
+	    if (lo < d) hi--;
+	    lo -= d;
+	}
+	/* times the mantissa of y */
+	__asm {
+	    qmul lo, my
+	    getqx pl
+	    getqy ph
+	}
+	ph += hi*my;
+	if (iy>>31) neg = !neg;
+	n = (ey > -14) ? SHR64(ph,pl,50-ey) : 0;
+	if (n > 150)
+	    return _powf_generic(x,y);
+	f = SHR64(ph,pl,23-ey)&0x7ffffff;
+	if (neg) {
+	    if (f) {
+		n = -n-1;
+		f = 0x8000000-f;
+	    } else {
+		n = -n;
+	    }
+	}
+	if ((int32_t)n < -126 || (int32_t)n > 127)
+	    return _powf_generic(x,y);
+	f |= 31<<27;
+	__asm {
+	    qexp f
+	    getqx r
+	}
+	r = ((r>>7)+1)>>1;			/* round to 23 bits */
+	SET_FLOAT_WORD(x,((n+126)<<23)+r);	/* r includes the leading 1 */
+	return x;
+}
+#endif
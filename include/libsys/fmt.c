@@ -676,8 +676,10 @@ int _basic_open(unsigned h, TxFunc sendf, RxFunc recvf, CloseFunc closef)
         }
         wrapper->f = sendf;
         v->putcf = (putcfunc_t)&wrapper->tx;
+        v->write = 0;
     } else {
         v->putcf = (putcfunc_t)sendf;
+        v->write = 0;
     }
     v->getcf = (getcfunc_t)recvf;
     v->close = (VFS_CloseFunc)closef;
@@ -717,7 +719,18 @@ int _basic_print_nl(unsigned h)
 
 int _basic_print_string(unsigned h, const char *ptr, unsigned fmt)
 {
-    TxFunc tf = _gettxfunc(h);
+    vfs_file_t *v;
+    TxFunc tf;
+
+    // a file with no buffer of its own (like the serial console) can
+    // take the whole string in one write
+    if (fmt == 0) {
+        v = __getftab(h);
+        if (v && v->state && v->write && !v->vfsdata) {
+            return (*v->write)(v, ptr, strlen(ptr));
+        }
+    }
+    tf = _gettxfunc(h);
     if (!tf) return 0;
     return _fmtstr(tf, fmt, ptr);
 }
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include "math_private.h"
 
 #define PI 3.14159265f
 #define PI_2 1.570796327f
@@ -18,6 +19,207 @@ float __builtin_fabsf(float f)
     return x.f;
 }
 
+#ifdef __P2__
+/*
+ * P2 versions, using the CORDIC
+ *
+ * sinf, cosf: absolute error below 2^-24 for |x| < 2^34 (beyond that
+ *   the argument reduction adds about |x| * 2^-63); within 1 ulp for
+ *   |x| < 1/32, where a short series is used
+ * tanf: the quotient of the above
+ * atanf, atan2f: within 2 ulp
+ */
+
+/* 2^33 / pi to 64 bits, for converting radians to 0.32 fixed point turns */
+#define TURN_SCALE_HI 0xA2F9836E
+#define TURN_SCALE_LO 0x4E441529
+/* 2pi / 2^32, for converting 0.32 fixed point turns back to radians */
+#define TURN_RADIANS 1.4629180792671596e-9f
+
+/*
+ * convert an angle x in radians into a fraction of a whole circle,
+ * in 0.32 fixed point; the multiply is done to 88 bits, so the error
+ * in 1/pi only matters for very large angles
+ */
+uint32_t _cordic_turns(float x)
+{
+    FI u;
+    int e;
+    uint32_t m, kh, kl, hi, mid, lo, t;
+
+    u.f = x;
+    e = ((u.i >> 23) & 0xff) - 127;
+    if (e < -38 || e > 56) {
+        return 0;
+    }
+    m = (u.i & 0x7fffff) | 0x800000;
+    kh = TURN_SCALE_HI;
+    kl = TURN_SCALE_LO;
+    __asm {
+        qmul m, kh
+        qmul m, kl
+        getqx mid
+        getqy hi
+        getqx lo
+        getqy t
+    }
+    mid += t;
+    if (mid < t) {
+        hi++;
+    }
+    if (e >= 25) {
+        t = SHR64(mid, lo, 57 - e);
+    } else {
+        t = SHR64(hi, mid, 25 - e);
+    }
+    if (u.i >> 31) {
+        t = -t;
+    }
+    return t;
+}
+
+float __builtin_sinf(float x)
+{
+    FI u;
+    float x2;
+    int32_t c, s;
+    uint32_t t;
+
+    u.f = x;
+    if (((u.i >> 23) & 0xff) == 0xff) {
+        // infinity or NaN: the result is NaN
+        u.i |= 0x400000;
+        return u.f;
+    }
+    if (((u.i >> 23) & 0xff) < 122) {
+        // |x| < 1/32
+        x2 = x * x;
+        return x - x * (x2 * (1.0f/6.0f));
+    }
+    t = _cordic_turns(x);
+    c = (1<<30);
+    __asm {
+        qrotate c, t
+        getqy s
+    }
+    return s * (1.0f / FIXPT_ONE);
+}
+
+float __builtin_cosf(float x)
+{
+    FI u;
+    float x2;
+    int32_t c;
+    uint32_t t;
+
+    u.f = x;
+    if (((u.i >> 23) & 0xff) == 0xff) {
+        // infinity or NaN: the result is NaN
+        u.i |= 0x400000;
+        return u.f;
+    }
+    if (((u.i >> 23) & 0xff) < 122) {
+        // |x| < 1/32
+        x2 = x * x;
+        return 1.0f - (x2 * 0.5f - x2 * x2 * (1.0f/24.0f));
+    }
+    t = _cordic_turns(x);
+    c = (1<<30);
+    __asm {
+        qrotate c, t
+        getqx c
+    }
+    return c * (1.0f / FIXPT_ONE);
+}
+
+float __builtin_tanf(float x)
+{
+    FI u;
+    float x2;
+    int32_t c, s;
+    uint32_t t;
+
+    u.f = x;
+    if (((u.i >> 23) & 0xff) == 0xff) {
+        // infinity or NaN: the result is NaN
+        u.i |= 0x400000;
+        return u.f;
+    }
+    if (((u.i >> 23) & 0xff) < 122) {
+        // |x| < 1/32
+        x2 = x * x;
+        return x + x * x2 * (1.0f/3.0f + x2 * (2.0f/15.0f));
+    }
+    t = _cordic_turns(x);
+    c = (1<<30);
+    __asm {
+        qrotate c, t
+        getqx c
+        getqy s
+    }
+    return (float)s / (float)c;
+}
+
+/*
+ * the mantissa of the float with bits i as 2.30 fixed point,
+ * scaled down by 2^(e - exponent of i)
+ */
+int32_t _cordic_fixed(uint32_t i, int e)
+{
+    int d;
+    int32_t m;
+
+    d = e - ((i >> 23) & 0xff);
+    if (d > 29 || !(i & 0x7f800000)) {
+        return 0;
+    }
+    m = (((i & 0x7fffff) | 0x800000) << 5) >> d;
+    if (i >> 31) {
+        m = -m;
+    }
+    return m;
+}
+
+float __builtin_atan2f(float y, float x)
+{
+    FI ux, uy;
+    int ex, ey;
+    int32_t cx, cy, a;
+    float r, r2;
+
+    ux.f = x;
+    uy.f = y;
+    ex = (ux.i >> 23) & 0xff;
+    ey = (uy.i >> 23) & 0xff;
+    if (ex - ey >= 4 && !(ux.i >> 31)) {
+        // |y/x| < 1/8; the CORDIC would lose too much precision here
+        r = y / x;
+        r2 = r * r;
+        return r + r * r2 * (-1.0f/3.0f + r2 * (1.0f/5.0f - r2 * (1.0f/7.0f)));
+    }
+    if (ey > ex) {
+        ex = ey;
+    }
+    cx = _cordic_fixed(ux.i, ex);
+    cy = _cordic_fixed(uy.i, ex);
+    __asm {
+        qvector cx, cy
+        getqy a
+    }
+    if (a == 0x80000000 && !(uy.i >> 31)) {
+        // the CORDIC gives -pi for y = 0, x < 0
+        return PI;
+    }
+    return a * TURN_RADIANS;
+}
+
+float __builtin_atanf(float x)
+{
+    return __builtin_atan2f(x, 1.0f);
+}
+
+#else
+
 /*
 '
 ' calculate sin(x) where x is an angle in
@@ -30,21 +232,6 @@ float __builtin_fabsf(float f)
 ' returns a value from -1.0 to +1.0, again in 2.30 fixed point
 '
 */
-#ifdef __P2__
-int32_t _isin(int32_t x)
-{
-    int32_t cx, rx, ry;
-
-    x = x<<2;  // convert to 0.32 fixed point
-    cx = (1<<30);
-    __asm {
-        qrotate cx, x
-        getqy ry
-    }
-    return ry;
-}
-
-#else
 int32_t _isin(int32_t x)
 {
     uint16_t *sinptr;
@@ -77,8 +264,6 @@ int32_t _isin(int32_t x)
     return sval << 16;
 }
 
-#endif
-
 float __builtin_sinf(float x)
 {
     float s;
@@ -92,7 +277,7 @@ float __builtin_cosf(float x)
     return __builtin_sinf(x + PI_2);
 }
 
-float __builtin_tanf(x)
+float __builtin_tanf(float x)
 {
     return __builtin_sinf(x) / __builtin_cosf(x);
 }
@@ -154,3 +339,5 @@ float __builtin_atan2f(float y, float x)
 {
     return normalized_atan2f(y,x) * PI_2;
 }
+
+#endif
@@ -25,4 +25,7 @@ static _INLINE uint32_t __asuint(float f) {
 #define GET_FLOAT_WORD(i, f) i = __asuint(f)
 #define SET_FLOAT_WORD(f, i) f = __asfloat(i)
 
+/* bits 0-31 of the 64 bit value hi:lo shifted right by s (0 < s < 64) */
+#define SHR64(hi, lo, s) ((s) >= 32 ? (hi) >> ((s) - 32) : ((lo) >> (s)) | ((hi) << (32 - (s))))
+
 #endif
@@ -54,8 +54,11 @@ end function
 
 ' convert an integer to a single character string
 function chr$(x as integer) as string
-  dim p as ubyte pointer
-  p = new ubyte(2)
+  return _chr_in(new ubyte(2), 2, x)
+end function
+
+' chr$ with the result in buffer p; size is always big enough
+function _chr_in(p as ubyte pointer, size as integer, x as integer) as string
   if (p) then
     p(0) = x
     p(1) = 0
@@ -67,7 +70,7 @@ class __strs_cl
   dim p as ubyte pointer
   dim i as integer
   function pfunc(c as integer) as integer
-    if (i < 16) then
+    if (i < 15) then
       p(i) = c
       i = i+1
       return 1
@@ -79,18 +82,19 @@ end class
 
 ' format a floating point number as a string
 function str$(x as single) as string
-  dim p as ubyte pointer
-  dim i as integer
+  return _str_in(new ubyte(16), 16, x)
+end function
+
+' str$ with the result in buffer p, which has room for 16 bytes
+function _str_in(p as ubyte pointer, size as integer, x as single) as string
   dim g as __strs_cl pointer
-  p = new ubyte(15)
-  i = 0
   if p then
     g = __builtin_alloca(8)
     g(0).p = p
-    g(0).i = i
+    g(0).i = 0
     _fmtfloat(@g(0).pfunc, 0, x, ASC("g"))
+    p(g(0).i) = 0
   end if
-  '' FIXME: should we check here that i is sensible?
   return p
 end function
 
@@ -99,6 +103,12 @@ end function
 ' if n == 0 then we just use enough digits to fit
 '
 function number$(val as uinteger, n as uinteger, B as uinteger) as string
+  return _number_in(nil, 0, val, n, B)
+end function
+
+' number$ with the result in buffer buf, which has room for size
+' bytes, if it fits
+function _number_in(buf as ubyte ptr, size as uinteger, val as uinteger, n as uinteger, B as uinteger) as string
   dim s as ubyte ptr
   dim d as uinteger
   dim tmp as uinteger
@@ -122,7 +132,14 @@ function number$(val as uinteger, n as uinteger, B as uinteger) as string
   if n > 32 then
     n = 32
   endif
-  s = new ubyte(n+1)
+  if n + 1 <= size then
+    s = buf
+  else
+    s = new ubyte(n+1)
+    if s = nil then
+      return s
+    end if
+  endif
   s[n] = 0
   while n > 0
     n -= 1
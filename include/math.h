@@ -19,10 +19,20 @@
 
 #define exp(x) __builtin_expf(x)
 #define log(x) __builtin_logf(x)
+#define pow(x, y) __builtin_powf((x), (y))
 #define sin(x) __builtin_sinf(x)
 #define cos(x) __builtin_cosf(x)
+#define tan(x) __builtin_tanf(x)
 #define atan(x) __builtin_atanf(x)
 #define atan2(y, x) __builtin_atan2f((y), (x))
+#define expf(x) __builtin_expf(x)
+#define logf(x) __builtin_logf(x)
+#define powf(x, y) __builtin_powf((x), (y))
+#define sinf(x) __builtin_sinf(x)
+#define cosf(x) __builtin_cosf(x)
+#define tanf(x) __builtin_tanf(x)
+#define atanf(x) __builtin_atanf(x)
+#define atan2f(y, x) __builtin_atan2f((y), (x))
 #define floor(x) __builtin_floorf(x)
 #define fabs(x)  __builtin_fabsf(x)
 #define frexp(x, p) __builtin_frexpf((x), (p))
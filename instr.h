@@ -90,9 +90,21 @@ typedef enum IROpcode {
     OPC_GETRND,
     OPC_HUBSET,
     OPC_JMPREL,
+    OPC_MUL,
+    OPC_MULS,
     OPC_NOT,
+    OPC_QDIV,
     OPC_QFRAC,
+    OPC_QMUL,
+    OPC_RDFAST,
+    OPC_RFBYTE,
+    OPC_RFLONG,
+    OPC_RFWORD,
     OPC_WAITX,
+    OPC_WFBYTE,
+    OPC_WFLONG,
+    OPC_WFWORD,
+    OPC_WRFAST,
     OPC_REPEAT,
     OPC_REPEAT_END,  // dummy instruction to mark end of repeat loop
     
@@ -198,6 +210,9 @@ enum flags {
     // be touched by the optimizer
     FLAG_KEEP_INSTR = 0x1000,
 
+    // loop which should not be placed in FCACHE
+    FLAG_NO_FCACHE = 0x2000,
+
     // rest of the bits are used by the optimizer
 
     FLAG_LABEL_USED = 0x10000,
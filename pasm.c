@@ -519,8 +519,16 @@ DeclareLabels(Module *P)
             } else {
                 cogpc = 0;
             }
-            tmpName = NewOrgName();
-            lastOrg = AddSymbol(&current->objsyms, tmpName, SYM_CONSTANT, AstInteger(cogpc), NULL);
+            if (ast->d.ptr) {
+                // labels may be declared again (in the system module,
+                // when library code is loaded into it), so keep the
+                // same org symbol for the labels to refer to
+                lastOrg = (Symbol *)ast->d.ptr;
+                lastOrg->val = AstInteger(cogpc);
+            } else {
+                tmpName = NewOrgName();
+                lastOrg = AddSymbol(&current->objsyms, tmpName, SYM_CONSTANT, AstInteger(cogpc), NULL);
+            }
             lasttype = ast_type_long;
             ast->d.ptr = (void *)lastOrg;
             inHub = 0;
@@ -0,0 +1,470 @@
+/*
+ * Spin to C/C++ converter
+ * Copyright 2011-2020 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ *
+ * code for profile guided optimization
+ *
+ * With -fprofile-generate every function entry, loop, and if
+ * statement gets counters (kept in sys/profile.spin), and the counts
+ * are printed on the serial port when the program finishes:
+ *
+ *   #profile 1
+ *   f <function> <calls>
+ *   l <function> <n> <entries> <iterations>
+ *   b <function> <n> <then count> <else count>
+ *   #end
+ *
+ * where <function> is "object.method" and <n> numbers the loops and
+ * if statements in the function in source order. With
+ * -fprofile-use=file those lines are read back (anything outside the
+ * #profile ... #end markers is ignored, and the counts from several
+ * runs are added together) and attached to the functions, where the
+ * back end uses them for inlining, FCACHE, and branch layout.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spinc.h"
+
+// counts for one site in a function
+typedef struct ProfileSite {
+    struct ProfileSite *next;
+    AST *ast;          // the loop or if statement, or NULL for the function itself
+    unsigned count[2];
+} ProfileSite;
+
+// one line of the profile file
+typedef struct ProfileRecord {
+    struct ProfileRecord *next;
+    int kind;          // 'f', 'l', or 'b'
+    char *func;
+    int site;
+    unsigned count[2];
+} ProfileRecord;
+
+static ProfileRecord *records;
+static unsigned maxcalls;    // largest function call count
+static int profileLoaded;
+
+// state for the function being instrumented
+static Function *proffunc;
+static const char *proffuncname;
+static int profsite;
+static int numcounters;      // counters used so far
+static AST *dumplist;        // statements printing the counters
+
+static ProfileRecord *
+FindRecord(int kind, const char *func, int site)
+{
+    ProfileRecord *r;
+    for (r = records; r; r = r->next) {
+        if (r->kind == kind && r->site == site && !strcmp(r->func, func)) {
+            return r;
+        }
+    }
+    return NULL;
+}
+
+static void
+LoadProfile(const char *fname)
+{
+    FILE *f;
+    char line[512];
+    char name[256];
+    int inprofile = 0;
+    int kind, site, n;
+    unsigned c0, c1;
+    ProfileRecord *r;
+
+    profileLoaded = 1;
+    f = fopen(fname, "r");
+    if (!f) {
+        ERROR(NULL, "Unable to read profile file %s", fname);
+        return;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        if (!strncmp(line, "#profile", 8)) {
+            inprofile = 1;
+            continue;
+        }
+        if (!strncmp(line, "#end", 4)) {
+            inprofile = 0;
+            continue;
+        }
+        if (!inprofile) {
+            continue;
+        }
+        kind = line[0];
+        site = 0;
+        c1 = 0;
+        if (kind == 'f') {
+            n = sscanf(line+1, "%255s %u", name, &c0);
+            if (n != 2) continue;
+        } else if (kind == 'l' || kind == 'b') {
+            n = sscanf(line+1, "%255s %d %u %u", name, &site, &c0, &c1);
+            if (n != 4) continue;
+        } else {
+            continue;
+        }
+        r = FindRecord(kind, name, site);
+        if (!r) {
+            r = (ProfileRecord *)calloc(1, sizeof(*r));
+            r->kind = kind;
+            r->func = strdup(name);
+            r->site = site;
+            r->next = records;
+            records = r;
+        }
+        r->count[0] += c0;
+        r->count[1] += c1;
+        if (kind == 'f' && r->count[0] > maxcalls) {
+            maxcalls = r->count[0];
+        }
+    }
+    fclose(f);
+}
+
+// create a statement that increments counter n
+static AST *
+CountStmt(int n)
+{
+    AST *call;
+    call = NewAST(AST_FUNCCALL, AstIdentifier("_prof_inc"),
+                  NewAST(AST_EXPRLIST, AstInteger(n), NULL));
+    return NewAST(AST_STMTLIST, call, NULL);
+}
+
+// add a line to the dump routine
+static void
+AddDumpLine(int kind, int site, int firstcounter, int numcount)
+{
+    char *desc;
+    AST *args;
+    AST *call;
+
+    desc = (char *)malloc(strlen(proffuncname) + 32);
+    if (kind == 'f') {
+        sprintf(desc, "f %s", proffuncname);
+    } else {
+        sprintf(desc, "%c %s %d", kind, proffuncname, site);
+    }
+    args = NewAST(AST_EXPRLIST, AstStringLiteral(desc), NULL);
+    args = AddToList(args, NewAST(AST_EXPRLIST, AstInteger(firstcounter), NULL));
+    args = AddToList(args, NewAST(AST_EXPRLIST, AstInteger(numcount), NULL));
+    call = NewAST(AST_FUNCCALL, AstIdentifier("_prof_line"), args);
+    dumplist = AddToList(dumplist, NewAST(AST_STMTLIST, call, NULL));
+}
+
+// remember the counts for a site in the current function
+static void
+AddSite(AST *ast, ProfileRecord *r)
+{
+    ProfileSite *s;
+    if (!r) {
+        return;
+    }
+    s = (ProfileSite *)calloc(1, sizeof(*s));
+    s->ast = ast;
+    s->count[0] = r->count[0];
+    s->count[1] = r->count[1];
+    s->next = proffunc->profile;
+    proffunc->profile = s;
+}
+
+// prepend a statement to a statement list
+static void
+PrependStmt(AST **listptr, AST *stmt)
+{
+    AST *list = *listptr;
+    if (list && list->kind != AST_STMTLIST) {
+        list = NewAST(AST_STMTLIST, list, NULL);
+    }
+    stmt->right = list;
+    *listptr = stmt;
+}
+
+static void ProfileStmtList(AST *list);
+
+//
+// process a loop; "stmtptr" points at the whole statement, and
+// "bodyptr" at the loop body
+//
+static void
+ProfileLoop(AST **stmtptr, AST *loop, AST **bodyptr)
+{
+    int site = profsite++;
+
+    if (gl_profile_generate) {
+        int n = numcounters;
+        numcounters += 2;
+        AddDumpLine('l', site, n, 2);
+        ProfileStmtList(*bodyptr);
+        PrependStmt(bodyptr, CountStmt(n+1));
+        *stmtptr = AddToList(CountStmt(n), NewAST(AST_STMTLIST, *stmtptr, NULL));
+    } else {
+        AddSite(loop, FindRecord('l', proffuncname, site));
+        ProfileStmtList(*bodyptr);
+    }
+}
+
+static void
+ProfileIf(AST *ifstmt)
+{
+    int site = profsite++;
+    AST *thenelse = ifstmt->right;
+
+    if (thenelse && thenelse->kind == AST_COMMENTEDNODE) {
+        thenelse = thenelse->left;
+    }
+    if (!thenelse || thenelse->kind != AST_THENELSE) {
+        return;
+    }
+    if (gl_profile_generate) {
+        int n = numcounters;
+        numcounters += 2;
+        AddDumpLine('b', site, n, 2);
+        ProfileStmtList(thenelse->left);
+        ProfileStmtList(thenelse->right);
+        PrependStmt(&thenelse->left, CountStmt(n));
+        PrependStmt(&thenelse->right, CountStmt(n+1));
+    } else {
+        AddSite(ifstmt, FindRecord('b', proffuncname, site));
+        ProfileStmtList(thenelse->left);
+        ProfileStmtList(thenelse->right);
+    }
+}
+
+static void
+ProfileStmt(AST **stmtptr)
+{
+    AST *stmt = *stmtptr;
+    AST *item;
+
+    if (!stmt) {
+        return;
+    }
+    switch (stmt->kind) {
+    case AST_COMMENTEDNODE:
+        ProfileStmt(&stmt->left);
+        break;
+    case AST_STMTLIST:
+        ProfileStmtList(stmt);
+        break;
+    case AST_SCOPE:
+    case AST_TRYENV:
+        ProfileStmtList(stmt->left);
+        break;
+    case AST_IF:
+        ProfileIf(stmt);
+        break;
+    case AST_WHILE:
+    case AST_DOWHILE:
+        ProfileLoop(stmtptr, stmt, &stmt->right);
+        break;
+    case AST_FOR:
+    case AST_FORATLEASTONCE:
+        if (stmt->right && stmt->right->kind == AST_TO
+            && stmt->right->right && stmt->right->right->kind == AST_STEP)
+        {
+            ProfileLoop(stmtptr, stmt, &stmt->right->right->right);
+        }
+        break;
+    case AST_CASE:
+        for (item = stmt->right; item; item = item->right) {
+            if (item->kind == AST_LISTHOLDER && item->left) {
+                ProfileStmtList(item->left->right);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void
+ProfileStmtList(AST *list)
+{
+    while (list && list->kind == AST_STMTLIST) {
+        ProfileStmt(&list->left);
+        list = list->right;
+    }
+}
+
+//
+// instrument the functions in module P, or attach the counts from
+// the profile file to them
+//
+void
+ProfileModule(Module *P)
+{
+    Function *pf;
+    Module *savecurrent = current;
+    Function *savefunc = curfunc;
+    char *name;
+
+    if (P == globalModule) {
+        return;
+    }
+    if (gl_profile_use && !profileLoaded) {
+        LoadProfile(gl_profile_use);
+    }
+    current = P;
+    for (pf = P->functions; pf; pf = pf->next) {
+        if (!pf->body || pf->body->kind == AST_STRING) {
+            continue;
+        }
+        if (gl_profile_generate && pf->cog_code) {
+            // counting would need hub calls from cog code
+            continue;
+        }
+        name = (char *)malloc(strlen(P->classname) + strlen(pf->name) + 2);
+        sprintf(name, "%s.%s", P->classname, pf->name);
+        proffunc = curfunc = pf;
+        proffuncname = name;
+        profsite = 0;
+        if (gl_profile_generate) {
+            int n = numcounters++;
+            AddDumpLine('f', 0, n, 1);
+            ProfileStmtList(pf->body);
+            PrependStmt(&pf->body, CountStmt(n));
+        } else {
+            AddSite(NULL, FindRecord('f', name, 0));
+            ProfileStmtList(pf->body);
+        }
+    }
+    current = savecurrent;
+    curfunc = savefunc;
+}
+
+static Function *
+SystemFunction(const char *name)
+{
+    Symbol *sym = FindSymbol(&globalModule->objsyms, name);
+    if (sym && sym->kind == SYM_FUNCTION) {
+        return (Function *)sym->val;
+    }
+    ERROR(NULL, "Internal error, could not find %s", name);
+    return NULL;
+}
+
+//
+// after all modules are instrumented, size the counter array and
+// fill in the code to print it
+//
+void
+ProfileFinish(void)
+{
+    Symbol *sym;
+    Function *f;
+    int numlines = AstListLen(dumplist);
+
+    if (!gl_profile_generate) {
+        return;
+    }
+    sym = FindSymbol(&globalModule->objsyms, "__real_profsize__");
+    if (!sym || sym->kind != SYM_CONSTANT) {
+        ERROR(NULL, "Internal error, could not find __real_profsize__");
+        return;
+    }
+    sym->val = AstInteger(numcounters ? numcounters : 1);
+    f = SystemFunction("_prof_sites");
+    if (f) {
+        f->body = dumplist;
+    }
+    // _prof_dump is called from the startup code
+    f = SystemFunction("_prof_dump");
+    if (f) {
+        f->no_inline = 1;
+    }
+    // let the inliner know how often these are really called
+    f = SystemFunction("_prof_line");
+    if (f) {
+        f->callSites += numlines;
+    }
+    f = SystemFunction("_prof_inc");
+    if (f) {
+        f->callSites += numcounters;
+    }
+}
+
+static ProfileSite *
+FindSite(Function *f, AST *ast)
+{
+    ProfileSite *s;
+    for (s = f->profile; s; s = s->next) {
+        if (s->ast == ast) {
+            return s;
+        }
+    }
+    return NULL;
+}
+
+//
+// returns 1 if f is called often, -1 if it was never called,
+// and 0 otherwise (or if there is no profile for f)
+//
+int
+ProfileFunctionHeat(Function *f)
+{
+    ProfileSite *s = FindSite(f, NULL);
+    if (!s) {
+        return 0;
+    }
+    if (s->count[0] == 0) {
+        return -1;
+    }
+    if (s->count[0] > 1 && s->count[0] >= maxcalls / 8) {
+        return 1;
+    }
+    return 0;
+}
+
+//
+// returns the number of times f was called, or -1 if there is no
+// profile for it
+//
+int
+ProfileFunctionCalls(Function *f)
+{
+    ProfileSite *s = FindSite(f, NULL);
+    if (!s) {
+        return -1;
+    }
+    return (int)(s->count[0] & 0x7fffffff);
+}
+
+//
+// check whether one branch of an if statement is much less common
+// than the other; returns 1 if the "then" part is rarely run, 2 if
+// the "else" part is, and 0 otherwise
+//
+int
+ProfileColdBranch(Function *f, AST *ifstmt)
+{
+    ProfileSite *s = FindSite(f, ifstmt);
+    if (!s) {
+        return 0;
+    }
+    if (s->count[0] * 16ULL < s->count[1]) {
+        return 1;
+    }
+    if (s->count[1] * 16ULL < s->count[0]) {
+        return 2;
+    }
+    return 0;
+}
+
+//
+// check whether a loop runs too few times each time it is entered
+// to be worth loading into FCACHE
+//
+bool
+ProfileFewIterations(Function *f, AST *loop)
+{
+    ProfileSite *s = FindSite(f, loop);
+    if (!s) {
+        return false;
+    }
+    return s->count[1] < 2ULL * s->count[0] || s->count[1] == 0;
+}
@@ -0,0 +1,700 @@
+/*
+ * Spin to C/C++ converter
+ * Copyright 2011-2020 Total Spectrum Software Inc.
+ * See the file COPYING for terms of use
+ *
+ * interprocedural constant propagation and function specialization
+ *
+ * If every call to a method passes the same constant for a parameter
+ * that the method never changes, the constant is substituted for the
+ * parameter inside the method. If only some calls pass constants, the
+ * hot ones (calls inside loops, or from functions the profile says
+ * are hot) are redirected to a copy of the method with the constants
+ * substituted, as long as the copies stay within a size budget.
+ * The usual CSE, loop, and back end optimizations then get to work
+ * on the constant values.
+ *
+ * The arguments are still passed, so the calling convention does not
+ * change; if the parameter is no longer used the back end will find
+ * that out by itself.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spinc.h"
+
+// limits on the copies we make (sizes are in AST nodes)
+#define SPEC_MAX_FUNC_SIZE  300  // largest method we will copy
+#define SPEC_TOTAL_BUDGET  2000  // total size of all copies
+#define SPEC_MAX_COPIES       4  // most copies of any one method
+
+#define SPEC_MAX_PARAMS      16  // we only look at this many parameters
+
+// a call to a candidate method
+typedef struct CallSite {
+    AST *call;         // the AST_FUNCCALL
+    Function *caller;
+    Function *callee;
+    int hot;           // 1 if the call is executed often
+    int used;          // 1 if the call has been redirected
+} CallSite;
+
+// information about a method
+typedef struct SpecFunc {
+    Function *func;
+    int badref;        // 1 if the method is referenced other than by a call
+} SpecFunc;
+
+static struct flexbuf sitebuf;
+static struct flexbuf funcbuf;
+static struct flexbuf unknownbuf; // names of methods called through unknown objects
+static int budget;
+
+static SpecFunc *
+GetSpecFunc(Function *f)
+{
+    SpecFunc *sf = (SpecFunc *)flexbuf_peek(&funcbuf);
+    size_t n = flexbuf_curlen(&funcbuf) / sizeof(SpecFunc);
+    SpecFunc newsf;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        if (sf[i].func == f) {
+            return &sf[i];
+        }
+    }
+    newsf.func = f;
+    newsf.badref = 0;
+    flexbuf_addmem(&funcbuf, (const char *)&newsf, sizeof(newsf));
+    sf = (SpecFunc *)flexbuf_peek(&funcbuf);
+    return &sf[n];
+}
+
+static void
+MarkBadRef(Symbol *sym)
+{
+    if (sym && sym->kind == SYM_FUNCTION) {
+        GetSpecFunc((Function *)sym->val)->badref = 1;
+    }
+}
+
+static void
+AddCallSite(AST *call, Function *callee, int hot)
+{
+    CallSite site;
+
+    site.call = call;
+    site.caller = curfunc;
+    site.callee = callee;
+    // the profile, if there is one, knows better than our guess
+    switch (ProfileFunctionHeat(curfunc)) {
+    case 1:
+        site.hot = 1;
+        break;
+    case -1:
+        site.hot = 0;
+        break;
+    default:
+        site.hot = hot;
+        break;
+    }
+    site.used = 0;
+    flexbuf_addmem(&sitebuf, (const char *)&site, sizeof(site));
+}
+
+static void
+AddUnknownName(AST *ident)
+{
+    const char *name;
+
+    if (ident && IsIdentifier(ident)) {
+        name = GetIdentifierName(ident);
+        flexbuf_addmem(&unknownbuf, (const char *)&name, sizeof(name));
+        if (ident->kind == AST_LOCAL_IDENTIFIER) {
+            name = GetUserIdentifierName(ident);
+            flexbuf_addmem(&unknownbuf, (const char *)&name, sizeof(name));
+        }
+    }
+}
+
+//
+// functions in other languages are not analyzed; any name they
+// use might refer to one of our methods
+//
+static void
+FindNamesUsed(AST *body)
+{
+    if (!body) return;
+    if (IsIdentifier(body)) {
+        AddUnknownName(body);
+        return;
+    }
+    FindNamesUsed(body->left);
+    FindNamesUsed(body->right);
+}
+
+static int
+IsLoop(AST *ast)
+{
+    switch (ast->kind) {
+    case AST_WHILE:
+    case AST_DOWHILE:
+    case AST_FOR:
+    case AST_FORATLEASTONCE:
+    case AST_COUNTREPEAT:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+//
+// find all the calls in a function body
+// "hot" is set for calls inside loops
+//
+static void
+FindCallSites(AST *body, int hot)
+{
+    Symbol *sym;
+
+    if (!body) return;
+    switch (body->kind) {
+    case AST_FUNCCALL:
+        sym = FindCalledFuncSymbol(body, NULL, 0);
+        if (sym && sym->kind == SYM_FUNCTION) {
+            AddCallSite(body, (Function *)sym->val, hot);
+        } else if (!sym && body->left && body->left->kind == AST_METHODREF) {
+            // a call through an object we cannot see; any method with
+            // this name could be the target
+            AddUnknownName(body->left->right);
+        }
+        if (body->left && body->left->kind == AST_METHODREF) {
+            FindCallSites(body->left->left, hot);
+        } else if (body->left && !IsIdentifier(body->left)) {
+            FindCallSites(body->left, hot);
+        }
+        FindCallSites(body->right, hot);
+        return;
+    case AST_IDENTIFIER:
+    case AST_LOCAL_IDENTIFIER:
+        MarkBadRef(LookupSymbolInFunc(curfunc, GetIdentifierName(body)));
+        return;
+    case AST_METHODREF:
+        MarkBadRef(FindFuncSymbol(body, NULL, 0));
+        FindCallSites(body->left, hot);
+        return;
+    case AST_CONSTREF:
+        FindCallSites(body->left, hot);
+        return;
+    default:
+        if (IsLoop(body)) {
+            hot = 1;
+        }
+        break;
+    }
+    FindCallSites(body->left, hot);
+    FindCallSites(body->right, hot);
+}
+
+//
+// check whether "ast" (whose parent is "parent") only reads its value
+//
+static int
+IsReadContext(AST *ast, AST *parent)
+{
+    if (!parent) {
+        return 1;
+    }
+    switch (parent->kind) {
+    case AST_OPERATOR:
+        switch (parent->d.ival) {
+        case K_INCREMENT:
+        case K_DECREMENT:
+        case '?':
+            return 0;
+        default:
+            return 1;
+        }
+    case AST_ASSIGN:
+    case AST_MEMREF:
+    case AST_ARRAYREF:
+    case AST_RANGEREF:
+        return ast == parent->right;
+    case AST_COUNTREPEAT:
+        return ast != parent->left;
+    case AST_EXPRLIST:
+    case AST_STMTLIST:
+    case AST_SEQUENCE:
+    case AST_COMMENTEDNODE:
+    case AST_RETURN:
+    case AST_IF:
+    case AST_THENELSE:
+    case AST_CONDRESULT:
+    case AST_WHILE:
+    case AST_DOWHILE:
+    case AST_CASE:
+    case AST_CASEITEM:
+    case AST_OTHER:
+    case AST_ISBETWEEN:
+    case AST_RANGE:
+    case AST_LOOKUP:
+    case AST_LOOKDOWN:
+    case AST_LOOKEXPR:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int
+IsParamRef(Function *f, AST *ast, Symbol *param)
+{
+    if (!ast || !IsIdentifier(ast)) {
+        return 0;
+    }
+    return LookupSymbolInFunc(f, GetIdentifierName(ast)) == param;
+}
+
+//
+// check whether function f might modify (or take the address of)
+// a parameter
+//
+static int
+ParamModified(Function *f, AST *body, AST *parent, Symbol *param)
+{
+    AST *list;
+
+    if (!body) return 0;
+    switch (body->kind) {
+    case AST_IDENTIFIER:
+    case AST_LOCAL_IDENTIFIER:
+        if (LookupSymbolInFunc(f, GetIdentifierName(body)) != param) {
+            return 0;
+        }
+        return !IsReadContext(body, parent);
+    case AST_INLINEASM:
+        return 1;
+    case AST_METHODREF:
+    case AST_CONSTREF:
+        return ParamModified(f, body->left, body, param);
+    case AST_ASSIGN:
+        if (body->left && body->left->kind == AST_EXPRLIST) {
+            for (list = body->left; list; list = list->right) {
+                if (IsParamRef(f, list->left, param)) {
+                    return 1;
+                }
+            }
+        }
+        break;
+    default:
+        break;
+    }
+    return ParamModified(f, body->left, body, param)
+        || ParamModified(f, body->right, body, param);
+}
+
+//
+// replace references to a parameter with a constant
+//
+static void
+SubstParam(Function *f, AST **astptr, Symbol *param, int32_t val)
+{
+    AST *ast = *astptr;
+    ASTReportInfo saveinfo;
+
+    if (!ast) return;
+    if (IsIdentifier(ast)) {
+        if (LookupSymbolInFunc(f, GetIdentifierName(ast)) == param) {
+            AstReportAs(ast, &saveinfo);
+            *astptr = AstInteger(val);
+            AstReportDone(&saveinfo);
+        }
+        return;
+    }
+    if (ast->kind == AST_METHODREF || ast->kind == AST_CONSTREF) {
+        SubstParam(f, &ast->left, param, val);
+        return;
+    }
+    SubstParam(f, &ast->left, param, val);
+    SubstParam(f, &ast->right, param, val);
+}
+
+static int
+AstSize(AST *ast)
+{
+    if (!ast) return 0;
+    return 1 + AstSize(ast->left) + AstSize(ast->right);
+}
+
+static int
+HasUnsafeCode(AST *body)
+{
+    if (!body) return 0;
+    switch (body->kind) {
+    case AST_INLINEASM:
+    case AST_SCOPE:
+        return 1;
+    default:
+        return HasUnsafeCode(body->left) || HasUnsafeCode(body->right);
+    }
+}
+
+static int
+IsUnknownMethodName(const char *name)
+{
+    const char **names = (const char **)flexbuf_peek(&unknownbuf);
+    size_t n = flexbuf_curlen(&unknownbuf) / sizeof(const char *);
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        if (!strcasecmp(names[i], name)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+//
+// check whether function f is one we can specialize at all
+//
+static int
+CanSpecialize(Function *f, int isBinary)
+{
+    if (!IsSpinLang(f->language) || f->module == globalModule) {
+        return 0;
+    }
+    if (f->numparams <= 0 || f->numparams == UNKNOWN_PARAMCOUNT) {
+        return 0;
+    }
+    if (f->is_public && !isBinary) {
+        return 0;
+    }
+    if (f->callSites == 0 || f->annotations || f->cog_task || f->used_as_ptr
+        || f->is_recursive || f->local_address_taken || f->closure || f->extradecl)
+    {
+        return 0;
+    }
+    if (!f->body || f->body->kind == AST_STRING || HasUnsafeCode(f->body)) {
+        return 0;
+    }
+    if (GetSpecFunc(f)->badref || IsUnknownMethodName(f->name) || IsUnknownMethodName(f->user_name)) {
+        return 0;
+    }
+    return 1;
+}
+
+//
+// find the parameters of f which are never modified, and so may
+// have constants substituted for them
+// returns the number of parameters examined
+//
+static int
+FindConstantParams(Function *f, Symbol **params)
+{
+    AST *list;
+    AST *ident;
+    AST *typ;
+    Symbol *sym;
+    int n = 0;
+
+    for (list = f->params; list && n < SPEC_MAX_PARAMS; list = list->right) {
+        ident = list->left;
+        params[n] = NULL;
+        if (ident && IsIdentifier(ident)) {
+            sym = FindSymbol(&f->localsyms, GetIdentifierName(ident));
+            if (sym && sym->kind == SYM_PARAMETER) {
+                typ = (AST *)sym->val;
+                if (!typ || ((IsIntType(typ) || IsGenericType(typ)) && TypeSize(typ) <= 4)) {
+                    if (!ParamModified(f, f->body, NULL, sym)) {
+                        params[n] = sym;
+                    }
+                }
+            }
+        }
+        n++;
+    }
+    return n;
+}
+
+//
+// get argument "n" of a call as a constant; returns 1 on success
+//
+static int
+GetConstArg(CallSite *site, int n, int32_t *val)
+{
+    AST *list = site->call->right;
+    AST *arg;
+    AST *typ;
+    Module *savecur = current;
+    Function *savefunc = curfunc;
+    int r = 0;
+
+    while (list && n > 0) {
+        list = list->right;
+        --n;
+    }
+    if (!list) return 0;
+    arg = list->left;
+    // constants are looked up relative to the caller
+    curfunc = site->caller;
+    current = site->caller->module;
+    if (arg && IsConstExpr(arg)) {
+        typ = ExprType(arg);
+        if (!typ || !IsFloatType(typ)) {
+            *val = EvalConstExpr(arg);
+            r = 1;
+        }
+    }
+    curfunc = savefunc;
+    current = savecur;
+    return r;
+}
+
+//
+// make a copy of f to specialize
+//
+static Function *
+CloneFunction(Function *f)
+{
+    Module *P = f->module;
+    Function *g = (Function *)malloc(sizeof(*g));
+    char *name = (char *)malloc(strlen(f->name) + 16);
+    int n = 1;
+
+    do {
+        sprintf(name, "%s_spec%d", f->name, n++);
+    } while (FindSymbol(&P->objsyms, name));
+
+    memcpy(g, f, sizeof(*g));
+    g->name = name;
+    g->user_name = name;
+    g->is_public = 0;
+    g->doccomment = NULL;
+    g->body = DupAST(f->body);
+    g->bedata = NULL;
+    g->profile = NULL;
+    g->visitFlag = 0;
+    g->callSites = 0;
+
+    g->next = f->next;
+    f->next = g;
+    AddSymbol(&P->objsyms, name, SYM_FUNCTION, (void *)g, NULL);
+    return g;
+}
+
+//
+// point a call at a different function
+// returns 0 if the call is not in a form we know how to change
+//
+static int
+CanRedirectCall(AST *call)
+{
+    AST *left = call->left;
+    if (left && IsIdentifier(left)) {
+        return 1;
+    }
+    if (left && left->kind == AST_METHODREF && left->right && IsIdentifier(left->right)) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+RedirectCall(AST *call, Function *g)
+{
+    AST *newname = AstIdentifier(g->name);
+
+    if (IsIdentifier(call->left)) {
+        call->left = newname;
+    } else {
+        call->left->right = newname;
+    }
+}
+
+
+static CallSite *
+GetCallSites(int *nsites)
+{
+    *nsites = flexbuf_curlen(&sitebuf) / sizeof(CallSite);
+    return (CallSite *)flexbuf_peek(&sitebuf);
+}
+
+//
+// find the calls in a function (or a copy of one)
+//
+static void
+FindFunctionCallSites(Function *f)
+{
+    Module *savecur = current;
+    Function *savefunc = curfunc;
+
+    current = f->module;
+    curfunc = f;
+    if (IsSpinLang(f->language)) {
+        FindCallSites(f->body, 0);
+    } else {
+        FindNamesUsed(f->body);
+    }
+    curfunc = savefunc;
+    current = savecur;
+}
+
+//
+// check whether a call passes the constants in vals[] for all the
+// parameters marked in isconst[], and no other constants
+//
+static int
+SameConstArgs(CallSite *site, Symbol **params, int *isconst, int32_t *vals, int nparams)
+{
+    int32_t v;
+    int j;
+
+    for (j = 0; j < nparams; j++) {
+        if (!params[j]) continue;
+        if (GetConstArg(site, j, &v)) {
+            if (!isconst[j] || v != vals[j]) {
+                return 0;
+            }
+        } else if (isconst[j]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void
+SpecializeFunction(Function *f)
+{
+    Symbol *params[SPEC_MAX_PARAMS];
+    int32_t vals[SPEC_MAX_PARAMS];
+    int isconst[SPEC_MAX_PARAMS];
+    CallSite *sites;
+    Function *g;
+    int nsites;
+    int nparams;
+    int nconst;
+    int i, j, k;
+    int count = 0;
+    int copies = 0;
+    int redirected = 0;
+    int moved;
+    int size;
+    int32_t v;
+
+    sites = GetCallSites(&nsites);
+    for (i = 0; i < nsites; i++) {
+        if (sites[i].callee != f) continue;
+        if (AstListLen(sites[i].call->right) != f->numparams) {
+            return;
+        }
+        count++;
+    }
+    if (count == 0) {
+        return;
+    }
+    nparams = FindConstantParams(f, params);
+
+    // a parameter which gets the same constant at every call can be
+    // replaced in f itself
+    for (j = 0; j < nparams; j++) {
+        if (!params[j]) continue;
+        k = 0;
+        for (i = 0; i < nsites; i++) {
+            if (sites[i].callee != f) continue;
+            if (!GetConstArg(&sites[i], j, &v) || (k && v != vals[j])) {
+                break;
+            }
+            vals[j] = v;
+            k = 1;
+        }
+        if (i == nsites) {
+            SubstParam(f, &f->body, params[j], vals[j]);
+            params[j] = NULL;
+        }
+    }
+
+    // now make copies for hot calls that pass other constants
+    // (unless we are optimizing for size)
+    size = AstSize(f->body);
+    if (size > SPEC_MAX_FUNC_SIZE || (gl_optimize_flags & OPT_OPTIMIZE_SIZE)) {
+        return;
+    }
+    for (i = 0; i < nsites && copies < SPEC_MAX_COPIES && size <= budget; i++) {
+        if (sites[i].callee != f || sites[i].used || !sites[i].hot) continue;
+        if (!CanRedirectCall(sites[i].call)) continue;
+        nconst = 0;
+        for (j = 0; j < nparams; j++) {
+            isconst[j] = params[j] && GetConstArg(&sites[i], j, &vals[j]);
+            nconst += isconst[j];
+        }
+        if (nconst == 0) continue;
+
+        g = CloneFunction(f);
+        for (j = 0; j < nparams; j++) {
+            if (isconst[j]) {
+                // g shares f's symbol table, so the symbols are the same
+                SubstParam(g, &g->body, params[j], vals[j]);
+            }
+        }
+        // send every call with the same constants to the copy
+        moved = 0;
+        for (k = i; k < nsites; k++) {
+            if (sites[k].callee != f || sites[k].used) continue;
+            if (!CanRedirectCall(sites[k].call)) continue;
+            if (!SameConstArgs(&sites[k], params, isconst, vals, nparams)) continue;
+            RedirectCall(sites[k].call, g);
+            sites[k].used = 1;
+            moved++;
+        }
+        g->callSites = moved;
+        redirected += moved;
+        budget -= size;
+        copies++;
+
+        // the calls in the copy are new call sites
+        k = nsites;
+        FindFunctionCallSites(g);
+        sites = GetCallSites(&nsites);
+        for (; k < nsites; k++) {
+            sites[k].callee->callSites++;
+        }
+    }
+    if (redirected) {
+        f->callSites = count - redirected;
+    }
+}
+
+void
+SpecializeFunctions(int isBinary)
+{
+    Module *P;
+    Function *f;
+
+    if ((gl_optimize_flags & OPT_SPECIALIZE) == 0 || gl_output != OUTPUT_ASM) {
+        return;
+    }
+    flexbuf_init(&sitebuf, 1024);
+    flexbuf_init(&funcbuf, 256);
+    flexbuf_init(&unknownbuf, 256);
+    budget = SPEC_TOTAL_BUDGET;
+
+    for (P = allparse; P; P = P->next) {
+        for (f = P->functions; f; f = f->next) {
+            if (f->callSites == 0 || !f->body || f->body->kind == AST_STRING) {
+                continue;
+            }
+            FindFunctionCallSites(f);
+        }
+    }
+    for (P = allparse; P; P = P->next) {
+        for (f = P->functions; f; f = f->next) {
+            if (CanSpecialize(f, isBinary)) {
+                SpecializeFunction(f);
+            }
+        }
+    }
+
+    flexbuf_delete(&sitebuf);
+    flexbuf_delete(&funcbuf);
+    flexbuf_delete(&unknownbuf);
+}
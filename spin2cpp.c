@@ -54,6 +54,7 @@ Usage(void)
     fprintf(stderr, "  --cc=CC:   use CC as the C++ compiler instead of PropGCC\n");
     fprintf(stderr, "  --code=x : PASM output only: control placement of code\n");
     fprintf(stderr, "             x can be cog (default) or hub (for LMM)\n");
+    fprintf(stderr, "  --cogplace=N: put up to N longs of frequently called functions in COG memory\n");
     fprintf(stderr, "  --ctypes : use inferred pointer (and other) types in generated C/C++ code\n");
     fprintf(stderr, "  --data=x : PASM output only: control placement of data\n");
     fprintf(stderr, "             x can be cog or hub (default is hub)\n");
@@ -66,6 +67,8 @@ Usage(void)
     fprintf(stderr, "  --gas:     create inline assembly out of DAT area;\n");
     fprintf(stderr, "             with --dat, create gas .S file from DAT area\n");
     fprintf(stderr, "  --list:    produce a listing file\n");
+    fprintf(stderr, "  --lmm=x:   PASM output only: choose the LMM kernel for hub code\n");
+    fprintf(stderr, "             x can be orig (default), slow, trace, cache, or lru\n");
     fprintf(stderr, "  --main:    include C++ main() function\n");
     fprintf(stderr, "  --noheader: skip the normal comment about spin2cpp version\n");
     fprintf(stderr, "  --nocse:   disable common subexpression optimizations on PASM code\n");
@@ -379,6 +382,17 @@ main(int argc, const char **argv)
                 gl_fcache_size = 0;
             }
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--lmm=", 6)) {
+            if (!ParseLmmOption(argv[0]+6)) {
+                Usage();
+            }
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--cogplace=", 11)) {
+            gl_cogplace_size = atoi(argv[0]+11);
+            if (gl_cogplace_size < 0) {
+                gl_cogplace_size = 0;
+            }
+            argv++; --argc;
         } else if (!strncmp(argv[0], "--fixed", 7)) {
             gl_fixedreal = 1;
             argv++; --argc;
@@ -93,7 +93,12 @@ makeClassNameSafe(Module *P)
 #include "sys/p2_code.spin.h"
 #include "sys/common.spin.h"
 #include "sys/float.spin.h"
+#include "sys/p2_float.spin.h"
 #include "sys/gcalloc.spin.h"
+#include "sys/profile.spin.h"
+#include "sys/bufserial.spin.h"
+#include "sys/p1_bufserial.spin.h"
+#include "sys/p2_bufserial.spin.h"
 
 void
 InitGlobalModule(void)
@@ -145,8 +150,28 @@ InitGlobalModule(void)
         spinyyparse();
         strToLex(globalModule->Lptr, (const char *)sys_float_spin, "_float_", LANG_SPIN_SPIN1);
         spinyyparse();
+        if (gl_p2) {
+            strToLex(globalModule->Lptr, (const char *)sys_p2_float_spin, "_p2_float_", LANG_SPIN_SPIN1);
+            spinyyparse();
+        }
         strToLex(globalModule->Lptr, (const char *)sys_gcalloc_spin, "_gc_", LANG_SPIN_SPIN1);
         spinyyparse();
+        if (gl_profile_generate || (gl_lmm_kind == LMM_KIND_LRU && gl_lmm_stats)) {
+            strToLex(globalModule->Lptr, (const char *)sys_profile_spin, "_profile_", LANG_SPIN_SPIN1);
+            spinyyparse();
+        }
+        if (gl_serial_buffered) {
+            // replaces the _txraw, _rxraw, _txbuf, and _txflush aliases
+            strToLex(globalModule->Lptr, (const char *)sys_bufserial_spin, "_bufserial_", LANG_SPIN_SPIN1);
+            spinyyparse();
+            if (gl_p2) {
+                syscode = (const char *)sys_p2_bufserial_spin;
+            } else {
+                syscode = (const char *)sys_p1_bufserial_spin;
+            }
+            strToLex(globalModule->Lptr, syscode, "_bufserial_", LANG_SPIN_SPIN1);
+            spinyyparse();
+        }
         
         ProcessModule(globalModule);
 
@@ -625,6 +650,60 @@ doPruneMethods(Module *P)
 
 static void MarkStaticFunctionPointers(AST *list);
 
+//
+// with --serial=buffered the startup code calls _bufser_init before
+// the program starts and _txflush when it returns, so make sure they
+// are kept too
+//
+static void
+MarkSerialFunctions(void)
+{
+    static const char *names[] = { "_bufser_init", "_txflush" };
+    Symbol *sym;
+    unsigned i;
+
+    if (!gl_serial_buffered) {
+        return;
+    }
+    for (i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+        sym = FindSymbol(&globalModule->objsyms, names[i]);
+        if (sym && sym->kind == SYM_FUNCTION) {
+            ((Function *)sym->val)->no_inline = 1;
+            MarkUsed((Function *)sym->val, "__serial__");
+        }
+    }
+}
+
+//
+// the profile code is called by the compiler rather than by the
+// program, so make sure it is kept
+//
+static void
+MarkProfileFunctions(void)
+{
+    static const char *names[] = { "_prof_dump", "_prof_line", "_prof_inc" };
+    Symbol *sym;
+    unsigned i;
+
+    if (gl_lmm_kind == LMM_KIND_LRU && gl_lmm_stats) {
+        sym = FindSymbol(&globalModule->objsyms, "_lmm_cache_stats");
+        if (sym && sym->kind == SYM_FUNCTION) {
+            // called from the startup code
+            ((Function *)sym->val)->no_inline = 1;
+            MarkUsed((Function *)sym->val, "__profile__");
+        }
+    }
+    if (!gl_profile_generate) {
+        return;
+    }
+    for (i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+        sym = FindSymbol(&globalModule->objsyms, names[i]);
+        if (sym && sym->kind == SYM_FUNCTION) {
+            MarkUsed((Function *)sym->val, "__profile__");
+        }
+    }
+}
+
 //
 // remove unused methods
 // if "isBinary" is true we can eliminate any methods not called
@@ -654,13 +733,15 @@ CheckUnusedMethods(int isBinary)
                 if (pf->callSites != 0) {
                     if (pf->is_public) {
                         MarkUsed(pf, "__public__");
-                    } else if (pf->annotations) {
+                    } else if (pf->annotations && !pf->prefer_inline) {
                         MarkUsed(pf, "__annotations__");
                     }
                 }
             }
         }
     }
+    MarkProfileFunctions();
+    MarkSerialFunctions();
     // check for functions called via pointers
     for (P = allparse; P; P = P->next) {
         current = P;
@@ -727,13 +808,15 @@ RemoveUnusedMethods(int isBinary)
                 if (pf->callSites == 0) {
                     if (pf->is_public) {
                         MarkUsed(pf, "__public__");
-                    } else if (pf->annotations) {
+                    } else if (pf->annotations && !pf->prefer_inline) {
                         MarkUsed(pf, "__annotations__");
                     }
                 }
             }
         }
     }
+    MarkProfileFunctions();
+    MarkSerialFunctions();
     // and check for function pointers in data
     for (P = allparse; P; P = P->next) {
         saveCur = current;
@@ -773,6 +856,235 @@ RemoveUnusedMethods(int isBinary)
     }
 }
 
+//
+// remove member variables that are never used, and the DAT
+// sections of objects whose methods have all been removed
+//
+typedef struct DataUse {
+    Module *P;
+    int minaddr;   // lowest offset of a variable whose address is used
+    int datused;   // 1 if DAT labels are referenced from outside
+} DataUse;
+
+static struct flexbuf datausebuf;
+
+#define VISITFLAG_RELAYOUT 0x02340001
+
+static DataUse *
+GetDataUse(Module *P)
+{
+    DataUse *du = (DataUse *)flexbuf_peek(&datausebuf);
+    size_t n = flexbuf_curlen(&datausebuf) / sizeof(DataUse);
+    DataUse newdu;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        if (du[i].P == P) {
+            return &du[i];
+        }
+    }
+    newdu.P = P;
+    newdu.minaddr = P->varsize;
+    newdu.datused = 0;
+    flexbuf_addmem(&datausebuf, (const char *)&newdu, sizeof(newdu));
+    du = (DataUse *)flexbuf_peek(&datausebuf);
+    return &du[n];
+}
+
+static Symbol *
+MemberVarSymbol(AST *ast)
+{
+    Symbol *sym;
+
+    if (!ast || !IsIdentifier(ast)) {
+        return NULL;
+    }
+    sym = LookupSymbolInFunc(curfunc, GetIdentifierName(ast));
+    if (sym && sym->kind == SYM_VARIABLE && sym->module) {
+        return sym;
+    }
+    return NULL;
+}
+
+// anything at or after a variable whose address is used may be
+// reached through that address, so it must stay where it is
+static void
+MarkAddressUsed(AST *ast)
+{
+    Symbol *sym;
+    DataUse *du;
+
+    while (ast && ast->kind == AST_ARRAYREF) {
+        ast = ast->left;
+    }
+    sym = MemberVarSymbol(ast);
+    if (sym) {
+        du = GetDataUse((Module *)sym->module);
+        if (sym->offset < du->minaddr) {
+            du->minaddr = sym->offset;
+        }
+    }
+}
+
+static void
+MarkDataUsed(AST *body)
+{
+    Symbol *sym;
+    AST *objtype;
+    Module *Q;
+
+    if (!body) return;
+    switch (body->kind) {
+    case AST_IDENTIFIER:
+    case AST_LOCAL_IDENTIFIER:
+        sym = MemberVarSymbol(body);
+        if (sym) {
+            sym->flags &= ~SYMF_NOALLOC;
+        }
+        return;
+    case AST_ADDROF:
+    case AST_ABSADDROF:
+        MarkAddressUsed(body->left);
+        break;
+    case AST_ARRAYREF:
+        // Spin allows indexing a plain variable to get at the ones after it
+        sym = MemberVarSymbol(body->left);
+        if (sym && !IsArrayType((AST *)sym->val)) {
+            MarkAddressUsed(body->left);
+        }
+        break;
+    case AST_CONSTREF:
+    case AST_METHODREF:
+        objtype = ExprType(body->left);
+        if (objtype && IsClassType(objtype) && body->right && IsIdentifier(body->right)) {
+            Q = GetClassPtr(objtype);
+            sym = Q ? FindSymbol(&Q->objsyms, GetIdentifierName(body->right)) : NULL;
+            if (sym && (sym->kind == SYM_LABEL || sym->kind == SYM_VARIABLE)) {
+                GetDataUse(Q)->datused = 1;
+                sym->flags &= ~SYMF_NOALLOC;
+            }
+        }
+        if (body->kind == AST_METHODREF) {
+            MarkDataUsed(body->left);
+        }
+        return;
+    default:
+        break;
+    }
+    MarkDataUsed(body->left);
+    MarkDataUsed(body->right);
+}
+
+static int
+MarkVarUnused(Symbol *sym, void *arg)
+{
+    if (sym->kind == SYM_VARIABLE && sym->module == arg) {
+        sym->flags |= SYMF_NOALLOC;
+    }
+    return 1;
+}
+
+static int
+KeepAddressedVar(Symbol *sym, void *arg)
+{
+    DataUse *du = (DataUse *)arg;
+    if (sym->kind == SYM_VARIABLE && sym->module == du->P && sym->offset >= du->minaddr) {
+        sym->flags &= ~SYMF_NOALLOC;
+    }
+    return 1;
+}
+
+static int
+RelayoutObjectVar(Symbol *sym, void *arg);
+
+static void
+RelayoutModule(Module *P)
+{
+    if (P->visitflag == VISITFLAG_RELAYOUT) {
+        return;
+    }
+    P->visitflag = VISITFLAG_RELAYOUT;
+    // sub-objects first, since their sizes may change
+    IterateOverSymbols(&P->objsyms, RelayoutObjectVar, (void *)P);
+    RelayoutMemberVariables(P);
+}
+
+static int
+RelayoutObjectVar(Symbol *sym, void *arg)
+{
+    AST *typ;
+
+    if (sym->kind == SYM_VARIABLE && sym->module == arg) {
+        typ = (AST *)sym->val;
+        while (typ && typ->kind == AST_ARRAYTYPE) {
+            typ = typ->left;
+        }
+        if (typ && IsClassType(typ)) {
+            RelayoutModule(GetClassPtr(typ));
+        }
+    }
+    return 1;
+}
+
+static void
+RemoveUnusedData(int isBinary)
+{
+    Module *P;
+    Function *pf;
+    Module *savecur = current;
+    Function *savefunc = curfunc;
+    DataUse *du;
+
+    if (!isBinary || gl_output != OUTPUT_ASM || 0 == (gl_optimize_flags & OPT_REMOVE_UNUSED_DATA)) {
+        return;
+    }
+    // other languages may get at member variables through pointers
+    for (P = allparse; P; P = P->next) {
+        if (P != globalModule && !IsSpinLang(P->mainLanguage)) {
+            return;
+        }
+    }
+    flexbuf_init(&datausebuf, 256);
+
+    // start by assuming nothing is used
+    for (P = allparse; P; P = P->next) {
+        if (P != globalModule && !P->isUnion) {
+            IterateOverSymbols(&P->objsyms, MarkVarUnused, (void *)P);
+        }
+    }
+    for (P = allparse; P; P = P->next) {
+        current = P;
+        for (pf = P->functions; pf; pf = pf->next) {
+            curfunc = pf;
+            MarkDataUsed(pf->body);
+        }
+    }
+    for (P = allparse; P; P = P->next) {
+        if (P == globalModule || P->isUnion) continue;
+        du = GetDataUse(P);
+        if (P->sharedVariables) {
+            // variables are probably shared with another COG
+            du->minaddr = 0;
+        }
+        IterateOverSymbols(&P->objsyms, KeepAddressedVar, (void *)du);
+    }
+
+    for (P = allparse; P; P = P->next) {
+        if (P != globalModule) {
+            RelayoutModule(P);
+        }
+    }
+    // nothing can reach the DAT of an object with no methods left
+    for (P = allparse->next; P; P = P->next) {
+        if (P != globalModule && !P->functions && !GetDataUse(P)->datused) {
+            P->datblock = NULL;
+        }
+    }
+    flexbuf_delete(&datausebuf);
+    curfunc = savefunc;
+    current = savecur;
+}
+
 static int
 ResolveSymbols()
 {
@@ -853,8 +1165,16 @@ FixupCode(Module *P, int isBinary)
         changes = ResolveSymbols();
     } while (changes);
     RemoveUnusedMethods(isBinary);
+    RemoveUnusedData(isBinary);
     doTypeInference();
-    
+
+    if (gl_profile_generate || gl_profile_use) {
+        for (Q = allparse; Q; Q = Q->next) {
+            ProfileModule(Q);
+        }
+        ProfileFinish();
+    }
+    SpecializeFunctions(isBinary);
     for (Q = allparse; Q; Q = Q->next) {
         PerformCSE(Q);
     }
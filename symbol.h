@@ -53,6 +53,7 @@ typedef struct symbol {
 /* symbol flags */
 #define SYMF_GLOBAL 0x01  /* used for some special system globals */
 #define SYMF_PRIVATE 0x02 /* symbol should not be used from other modules */
+#define SYMF_NOALLOC 0x04 /* member variable is unused and gets no space */
 
 #define INTVAL(sym) ((intptr_t)((sym)->val))
 
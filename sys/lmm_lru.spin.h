@@ -0,0 +1,684 @@
+unsigned char sys_lmm_lru_spin[] = {
+  0x09, 0x27, 0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x63, 0x61, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x4c, 0x4d, 0x4d, 0x0a,
+  0x09, 0x27, 0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x68, 0x75, 0x62, 0x20,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x4e,
+  0x47, 0x53, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x63, 0x6f, 0x70, 0x69,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x20, 0x61, 0x72, 0x65, 0x61, 0x3b,
+  0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x69,
+  0x73, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x74, 0x6f, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4e, 0x45, 0x58, 0x54,
+  0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+  0x20, 0x67, 0x6f, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x6c, 0x69, 0x6e,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x75, 0x62, 0x20, 0x63, 0x6f, 0x64,
+  0x65, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20, 0x73,
+  0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x3a, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x20, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f,
+  0x4c, 0x4f, 0x4e, 0x47, 0x53, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x70, 0x65, 0x72,
+  0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x28, 0x61, 0x20, 0x70, 0x6f, 0x77,
+  0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x32, 0x29, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x20, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f,
+  0x4c, 0x4f, 0x47, 0x32, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x67, 0x32,
+  0x28, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f,
+  0x4e, 0x47, 0x53, 0x29, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x20, 0x20, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x65, 0x74, 0x73, 0x20, 0x28, 0x61, 0x20, 0x70, 0x6f,
+  0x77, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x32, 0x29, 0x0a, 0x09, 0x27,
+  0x27, 0x20, 0x20, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x57, 0x41, 0x59, 0x53,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73,
+  0x20, 0x69, 0x6e, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x65, 0x74,
+  0x0a, 0x09, 0x27, 0x27, 0x20, 0x20, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x43,
+  0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x20, 0x20,
+  0x31, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d,
+  0x69, 0x73, 0x73, 0x65, 0x73, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09, 0x27,
+  0x27, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+  0x77, 0x61, 0x79, 0x20, 0x77, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x6e,
+  0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x77, 0x2a, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x2b, 0x6e, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x74,
+  0x0a, 0x09, 0x27, 0x27, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41,
+  0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x52, 0x54, 0x20, 0x2b, 0x20,
+  0x28, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f,
+  0x4e, 0x47, 0x53, 0x2b, 0x31, 0x29, 0x2a, 0x28, 0x6c, 0x69, 0x6e, 0x65,
+  0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x29, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x61, 0x20, 0x6c, 0x69, 0x6e, 0x65,
+  0x20, 0x69, 0x73, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x72, 0x65, 0x63,
+  0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x65,
+  0x74, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x70,
+  0x6c, 0x61, 0x63, 0x65, 0x64, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09, 0x27,
+  0x27, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x20, 0x68, 0x6f, 0x6c,
+  0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x4f, 0x47, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x0a, 0x09,
+  0x27, 0x27, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x3b, 0x20, 0x6c, 0x72,
+  0x75, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c,
+  0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x55, 0x42, 0x20, 0x61,
+  0x6e, 0x64, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x43, 0x4f, 0x47, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x69, 0x74, 0x20,
+  0x69, 0x73, 0x20, 0x69, 0x6e, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x4c, 0x4d,
+  0x4d, 0x5f, 0x4c, 0x4f, 0x4f, 0x50, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x72,
+  0x75, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x62, 0x20, 0x63,
+  0x6f, 0x64, 0x65, 0x20, 0x61, 0x74, 0x20, 0x70, 0x63, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63, 0x2c, 0x20, 0x70,
+  0x63, 0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f,
+  0x67, 0x6f, 0x0a, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x4e, 0x45, 0x58, 0x54,
+  0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x70, 0x63, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x62,
+  0x61, 0x73, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x70, 0x63, 0x2c, 0x20, 0x23, 0x34, 0x2a, 0x4c, 0x4d, 0x4d, 0x5f,
+  0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x53, 0x0a, 0x09,
+  0x6a, 0x6d, 0x70, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x67, 0x6f, 0x0a,
+  0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x45, 0x54, 0x0a, 0x09, 0x73, 0x75,
+  0x62, 0x09, 0x73, 0x70, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x72, 0x64,
+  0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63, 0x2c,
+  0x20, 0x73, 0x70, 0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09, 0x23, 0x6c, 0x72,
+  0x75, 0x5f, 0x67, 0x6f, 0x0a, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x43, 0x41,
+  0x4c, 0x4c, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f,
+  0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x2c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20,
+  0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x63, 0x61, 0x6c, 0x6c, 0x09, 0x23,
+  0x6c, 0x72, 0x75, 0x5f, 0x68, 0x75, 0x62, 0x61, 0x64, 0x64, 0x72, 0x0a,
+  0x09, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72, 0x75, 0x5f,
+  0x70, 0x63, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a,
+  0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09, 0x23, 0x6c,
+  0x72, 0x75, 0x5f, 0x70, 0x75, 0x73, 0x68, 0x0a, 0x0a, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x50, 0x54, 0x52, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63, 0x2c, 0x20, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x50, 0x43, 0x0a, 0x09, 0x63,
+  0x61, 0x6c, 0x6c, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x75, 0x62,
+  0x61, 0x64, 0x64, 0x72, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x75, 0x73,
+  0x68, 0x0a, 0x09, 0x77, 0x72, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x73, 0x70, 0x0a, 0x09, 0x61,
+  0x64, 0x64, 0x09, 0x73, 0x70, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x6a,
+  0x6d, 0x70, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x67, 0x6f, 0x0a, 0x0a,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x4a, 0x55, 0x4d, 0x50, 0x0a, 0x09, 0x6d, 0x75,
+  0x78, 0x63, 0x09, 0x73, 0x61, 0x76, 0x65, 0x5f, 0x63, 0x7a, 0x2c, 0x20,
+  0x23, 0x31, 0x0a, 0x09, 0x6d, 0x75, 0x78, 0x6e, 0x7a, 0x09, 0x73, 0x61,
+  0x76, 0x65, 0x5f, 0x63, 0x7a, 0x2c, 0x20, 0x23, 0x32, 0x0a, 0x09, 0x63,
+  0x61, 0x6c, 0x6c, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x75, 0x62,
+  0x61, 0x64, 0x64, 0x72, 0x0a, 0x09, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67,
+  0x09, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x61, 0x20, 0x6a,
+  0x75, 0x6d, 0x70, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x77,
+  0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x73, 0x61, 0x6d, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x61,
+  0x6e, 0x20, 0x67, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x0a, 0x09, 0x27, 0x27, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6e, 0x6f, 0x77, 0x20, 0x6f, 0x6e, 0x3b,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x64, 0x20,
+  0x74, 0x6f, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x0a, 0x09, 0x6d, 0x6f,
+  0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c,
+  0x72, 0x75, 0x5f, 0x70, 0x63, 0x0a, 0x09, 0x73, 0x75, 0x62, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x62, 0x61, 0x73, 0x65, 0x0a, 0x09, 0x63, 0x6d, 0x70, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x34, 0x2a, 0x4c, 0x4d,
+  0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x53,
+  0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x6e, 0x63, 0x09,
+  0x6a, 0x6d, 0x70, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x69, 0x6e,
+  0x64, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x2c, 0x20, 0x23, 0x32, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x73, 0x75,
+  0x62, 0x09, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x2c, 0x20, 0x23, 0x31,
+  0x09, 0x09, 0x27, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c,
+  0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x66,
+  0x69, 0x78, 0x31, 0x2c, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x0a,
+  0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x69,
+  0x78, 0x32, 0x2c, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x0a, 0x09,
+  0x61, 0x64, 0x64, 0x09, 0x4c, 0x4d, 0x4d, 0x5f, 0x63, 0x61, 0x63, 0x68,
+  0x65, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x2c, 0x20, 0x23,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54,
+  0x41, 0x54, 0x53, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x69, 0x78, 0x31,
+  0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x73, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x6c, 0x72, 0x75, 0x5f,
+  0x66, 0x69, 0x78, 0x32, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x6e, 0x09, 0x30,
+  0x2d, 0x30, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x77, 0x72, 0x62, 0x69,
+  0x74, 0x09, 0x09, 0x27, 0x20, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20,
+  0x61, 0x20, 0x6a, 0x6d, 0x70, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x73,
+  0x61, 0x76, 0x65, 0x5f, 0x63, 0x7a, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77,
+  0x7a, 0x2c, 0x77, 0x63, 0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09,
+  0x27, 0x27, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x69, 0x6e, 0x65, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67,
+  0x20, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63, 0x2c, 0x20, 0x6c, 0x6f, 0x61,
+  0x64, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x20, 0x69, 0x66, 0x20, 0x6e,
+  0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79, 0x2c, 0x0a, 0x09, 0x27,
+  0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x74,
+  0x68, 0x65, 0x72, 0x65, 0x3b, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x61,
+  0x62, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x09,
+  0x27, 0x27, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x67, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0a, 0x09,
+  0x27, 0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x70,
+  0x63, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+  0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4e,
+  0x45, 0x57, 0x5f, 0x50, 0x43, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73,
+  0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x6d,
+  0x61, 0x79, 0x20, 0x73, 0x65, 0x74, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x50, 0x43, 0x20, 0x61, 0x74,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x75, 0x73, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x0a, 0x09, 0x27, 0x27, 0x0a,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x4a, 0x55, 0x4d, 0x50, 0x5f, 0x50, 0x54, 0x52,
+  0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63,
+  0x2c, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x50, 0x43,
+  0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x67, 0x6f, 0x0a, 0x09, 0x6d, 0x75, 0x78,
+  0x63, 0x09, 0x73, 0x61, 0x76, 0x65, 0x5f, 0x63, 0x7a, 0x2c, 0x20, 0x23,
+  0x31, 0x0a, 0x09, 0x6d, 0x75, 0x78, 0x6e, 0x7a, 0x09, 0x73, 0x61, 0x76,
+  0x65, 0x5f, 0x63, 0x7a, 0x2c, 0x20, 0x23, 0x32, 0x0a, 0x6c, 0x72, 0x75,
+  0x5f, 0x66, 0x69, 0x6e, 0x64, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x6c, 0x6f, 0x6f,
+  0x6b, 0x75, 0x70, 0x73, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x43,
+  0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x0a, 0x09,
+  0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6c, 0x6f, 0x63,
+  0x6b, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x70, 0x63, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x6e, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x61, 0x67, 0x2c, 0x20, 0x23, 0x34, 0x2a, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x53, 0x2d,
+  0x31, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67,
+  0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69,
+  0x6e, 0x65, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e,
+  0x45, 0x5f, 0x4c, 0x4f, 0x47, 0x32, 0x2b, 0x32, 0x0a, 0x09, 0x61, 0x6e,
+  0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20,
+  0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x2d, 0x31, 0x0a,
+  0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09,
+  0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c,
+  0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x73, 0x0a, 0x09,
+  0x6d, 0x6f, 0x76, 0x73, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6d, 0x70,
+  0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x57, 0x41, 0x59, 0x53, 0x0a,
+  0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6d, 0x70, 0x0a, 0x09, 0x63, 0x6d, 0x70,
+  0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x2c, 0x20, 0x30, 0x2d,
+  0x30, 0x20, 0x77, 0x7a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x7a, 0x09,
+  0x6a, 0x6d, 0x70, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x69, 0x74,
+  0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6d,
+  0x70, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53,
+  0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69,
+  0x6e, 0x65, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54,
+  0x53, 0x0a, 0x09, 0x64, 0x6a, 0x6e, 0x7a, 0x09, 0x6c, 0x72, 0x75, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f,
+  0x63, 0x6d, 0x70, 0x0a, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x61, 0x20, 0x6d,
+  0x69, 0x73, 0x73, 0x3a, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x20, 0x72,
+  0x65, 0x63, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64,
+  0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x65, 0x74, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x4c, 0x4d,
+  0x4d, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x6d, 0x69, 0x73, 0x73,
+  0x65, 0x73, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x43,
+  0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x53, 0x0a, 0x09, 0x73, 0x75,
+  0x62, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20,
+  0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x2a, 0x4c, 0x4d,
+  0x4d, 0x5f, 0x57, 0x41, 0x59, 0x53, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75,
+  0x5f, 0x61, 0x67, 0x65, 0x73, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x73, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x67, 0x65, 0x74, 0x61, 0x67, 0x65, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6e, 0x65, 0x67,
+  0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6f, 0x6c, 0x64, 0x65, 0x73, 0x74, 0x2c,
+  0x20, 0x23, 0x31, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x57, 0x41, 0x59, 0x53, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x67, 0x65,
+  0x74, 0x61, 0x67, 0x65, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x30, 0x2d, 0x30, 0x0a, 0x09,
+  0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x67, 0x65, 0x74, 0x61,
+  0x67, 0x65, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54,
+  0x53, 0x0a, 0x09, 0x63, 0x6d, 0x70, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6f, 0x6c, 0x64, 0x65,
+  0x73, 0x74, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x63,
+  0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6f, 0x6c, 0x64,
+  0x65, 0x73, 0x74, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x63, 0x09, 0x6d, 0x6f, 0x76, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x76, 0x69, 0x63, 0x74, 0x69, 0x6d, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64,
+  0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20,
+  0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x0a, 0x09, 0x64,
+  0x6a, 0x6e, 0x7a, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x67, 0x65, 0x74, 0x61,
+  0x67, 0x65, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f,
+  0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x76, 0x69,
+  0x63, 0x74, 0x69, 0x6d, 0x0a, 0x09, 0x63, 0x61, 0x6c, 0x6c, 0x09, 0x23,
+  0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x0a, 0x09, 0x6a, 0x6d,
+  0x70, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x65, 0x6e, 0x74, 0x65, 0x72,
+  0x0a, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x69, 0x74, 0x0a, 0x09, 0x63,
+  0x61, 0x6c, 0x6c, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67,
+  0x61, 0x64, 0x64, 0x72, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x65, 0x6e, 0x74,
+  0x65, 0x72, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x73, 0x20,
+  0x75, 0x73, 0x65, 0x64, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x61,
+  0x67, 0x65, 0x73, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x73, 0x65, 0x74, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x61, 0x67, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x70,
+  0x63, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x61, 0x67, 0x65,
+  0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20, 0x6c,
+  0x72, 0x75, 0x5f, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x09, 0x73, 0x75,
+  0x62, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x32, 0x0a,
+  0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e,
+  0x65, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x73, 0x61, 0x76, 0x65, 0x5f,
+  0x63, 0x7a, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77, 0x7a, 0x2c, 0x77, 0x63,
+  0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d,
+  0x70, 0x0a, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x62, 0x20,
+  0x63, 0x6f, 0x64, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x74, 0x61, 0x67, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6e,
+  0x65, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x0a, 0x09, 0x27, 0x27, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x74, 0x20,
+  0x69, 0x73, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x6c,
+  0x6f, 0x61, 0x64, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x66, 0x63, 0x61, 0x64, 0x64, 0x72, 0x2c, 0x20, 0x23, 0x30, 0x09,
+  0x09, 0x27, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+  0x6d, 0x61, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20,
+  0x61, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x61, 0x67, 0x73, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x61, 0x67, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x63, 0x61, 0x6c,
+  0x6c, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x61, 0x64,
+  0x64, 0x72, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x61,
+  0x67, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x0a, 0x09, 0x6d, 0x6f, 0x76,
+  0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x64, 0x6c, 0x70, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x0a,
+  0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e,
+  0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64,
+  0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x64, 0x6c, 0x70, 0x32, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x27, 0x27, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x65, 0x6e, 0x64,
+  0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x6d,
+  0x70, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78,
+  0x74, 0x20, 0x6f, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x53, 0x2d,
+  0x31, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f,
+  0x73, 0x65, 0x74, 0x6a, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61,
+  0x67, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c,
+  0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x4e, 0x47, 0x53, 0x2f, 0x32, 0x0a,
+  0x09, 0x27, 0x27, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x2c, 0x20,
+  0x73, 0x6f, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e,
+  0x67, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x65,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x68,
+  0x75, 0x62, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x0a, 0x6c, 0x72,
+  0x75, 0x5f, 0x6c, 0x64, 0x6c, 0x70, 0x0a, 0x09, 0x72, 0x64, 0x6c, 0x6f,
+  0x6e, 0x67, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x70, 0x74, 0x72, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x61, 0x64,
+  0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x64, 0x6c, 0x70, 0x2c, 0x20,
+  0x69, 0x6e, 0x63, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x32, 0x0a, 0x6c, 0x72,
+  0x75, 0x5f, 0x6c, 0x64, 0x6c, 0x70, 0x32, 0x0a, 0x09, 0x72, 0x64, 0x6c,
+  0x6f, 0x6e, 0x67, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x70, 0x74, 0x72, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x61,
+  0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x64, 0x6c, 0x70, 0x32,
+  0x2c, 0x20, 0x69, 0x6e, 0x63, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x32, 0x0a,
+  0x09, 0x64, 0x6a, 0x6e, 0x7a, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x64,
+  0x6c, 0x70, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x6a, 0x6d,
+  0x70, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x6a, 0x6d, 0x70, 0x6e, 0x65, 0x78, 0x74, 0x0a,
+  0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x72, 0x65, 0x74,
+  0x0a, 0x09, 0x72, 0x65, 0x74, 0x0a, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x66,
+  0x69, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x4f, 0x47, 0x20,
+  0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6c,
+  0x69, 0x6e, 0x65, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+  0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x61, 0x64, 0x64, 0x72,
+  0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f,
+  0x67, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x0a, 0x09, 0x73, 0x68, 0x6c, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x23, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x5f, 0x4c, 0x4f, 0x47, 0x32,
+  0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f,
+  0x67, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x23, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54,
+  0x41, 0x52, 0x54, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x61,
+  0x64, 0x64, 0x72, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x72, 0x65, 0x74,
+  0x0a, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x48, 0x55, 0x42, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f,
+  0x6e, 0x67, 0x20, 0x61, 0x74, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41,
+  0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x75, 0x62, 0x61, 0x64, 0x64, 0x72,
+  0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d,
+  0x70, 0x2c, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x0a, 0x09, 0x73,
+  0x75, 0x62, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20,
+  0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x6c, 0x69, 0x6e, 0x65, 0x0a,
+  0x09, 0x73, 0x68, 0x6c, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x23, 0x32, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x62,
+  0x61, 0x73, 0x65, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x75, 0x62, 0x61,
+  0x64, 0x64, 0x72, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x72, 0x65, 0x74,
+  0x0a, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x63, 0x61,
+  0x6c, 0x6c, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x43, 0x4f, 0x47,
+  0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x68,
+  0x75, 0x62, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x0a, 0x09, 0x27, 0x27, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x62, 0x20, 0x63, 0x6f, 0x64, 0x65,
+  0x20, 0x6d, 0x61, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x68, 0x6f,
+  0x6c, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x4f,
+  0x47, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x27, 0x73, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x6f, 0x20,
+  0x72, 0x65, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x75,
+  0x74, 0x20, 0x69, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x61, 0x66,
+  0x74, 0x65, 0x72, 0x77, 0x61, 0x72, 0x64, 0x73, 0x0a, 0x09, 0x27, 0x27,
+  0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x52,
+  0x4f, 0x4d, 0x5f, 0x43, 0x4f, 0x47, 0x0a, 0x09, 0x77, 0x72, 0x6c, 0x6f,
+  0x6e, 0x67, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c,
+  0x20, 0x73, 0x70, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x73, 0x70, 0x2c,
+  0x20, 0x23, 0x34, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c, 0x69,
+  0x6e, 0x65, 0x0a, 0x09, 0x73, 0x68, 0x6c, 0x09, 0x6c, 0x72, 0x75, 0x5f,
+  0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x39, 0x0a, 0x09, 0x6d, 0x6f, 0x76,
+  0x73, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x52, 0x4f, 0x4d,
+  0x5f, 0x43, 0x4f, 0x47, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x77, 0x72,
+  0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x73, 0x70, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x73, 0x70,
+  0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x77, 0x72, 0x6c, 0x6f, 0x6e, 0x67,
+  0x09, 0x68, 0x75, 0x62, 0x72, 0x65, 0x74, 0x70, 0x74, 0x72, 0x2c, 0x20,
+  0x73, 0x70, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x73, 0x70, 0x2c, 0x20,
+  0x23, 0x34, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x73, 0x09, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x52, 0x4f, 0x4d, 0x5f, 0x43,
+  0x4f, 0x47, 0x5f, 0x72, 0x65, 0x74, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x67, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x6a, 0x6d, 0x70,
+  0x09, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x4f, 0x4f, 0x50, 0x0a, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x46, 0x52, 0x4f, 0x4d,
+  0x5f, 0x43, 0x4f, 0x47, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x72, 0x65,
+  0x74, 0x0a, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x72, 0x65,
+  0x74, 0x0a, 0x09, 0x73, 0x75, 0x62, 0x09, 0x73, 0x70, 0x2c, 0x20, 0x23,
+  0x34, 0x0a, 0x09, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x72, 0x65, 0x74, 0x2c, 0x20, 0x73, 0x70, 0x0a, 0x09, 0x73,
+  0x75, 0x62, 0x09, 0x73, 0x70, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x72,
+  0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61,
+  0x67, 0x2c, 0x20, 0x73, 0x70, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x23, 0x39, 0x0a, 0x09,
+  0x61, 0x6e, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x72, 0x65, 0x74, 0x2c,
+  0x20, 0x23, 0x24, 0x31, 0x66, 0x66, 0x0a, 0x09, 0x74, 0x6a, 0x7a, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x72, 0x65, 0x74, 0x09, 0x27, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61,
+  0x20, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x61, 0x67, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x6c,
+  0x69, 0x6e, 0x65, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x61, 0x67, 0x73, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x73, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x63, 0x6d, 0x70, 0x74, 0x61, 0x67, 0x2c, 0x20, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x63, 0x61, 0x6c, 0x6c, 0x09,
+  0x23, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67, 0x61, 0x64, 0x64, 0x72,
+  0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6d, 0x70, 0x74, 0x61, 0x67, 0x0a,
+  0x09, 0x63, 0x6d, 0x70, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67,
+  0x2c, 0x20, 0x30, 0x2d, 0x30, 0x20, 0x77, 0x7a, 0x0a, 0x20, 0x20, 0x69,
+  0x66, 0x5f, 0x6e, 0x7a, 0x09, 0x63, 0x61, 0x6c, 0x6c, 0x09, 0x23, 0x6c,
+  0x72, 0x75, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x0a, 0x09, 0x6a, 0x6d, 0x70,
+  0x09, 0x6c, 0x72, 0x75, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x0a, 0x09, 0x27,
+  0x27, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
+  0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6c, 0x6f,
+  0x61, 0x64, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x4c, 0x4d, 0x4d, 0x5f,
+  0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x52, 0x54,
+  0x20, 0x61, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2c, 0x20, 0x6f, 0x6e, 0x20,
+  0x74, 0x6f, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x68, 0x61, 0x74, 0x65,
+  0x76, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x77, 0x65,
+  0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x6f,
+  0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x73, 0x20,
+  0x77, 0x68, 0x69, 0x63, 0x68, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x64, 0x65,
+  0x70, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x74, 0x69, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x63, 0x61, 0x63,
+  0x68, 0x65, 0x20, 0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x6d, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x09,
+  0x27, 0x27, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x66,
+  0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x62,
+  0x79, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x6c, 0x6f,
+  0x6f, 0x70, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x77, 0x69,
+  0x74, 0x68, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x62, 0x61,
+  0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x4f,
+  0x4f, 0x50, 0x20, 0x61, 0x74, 0x20, 0x70, 0x63, 0x0a, 0x09, 0x27, 0x27,
+  0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x69,
+  0x73, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x09, 0x27, 0x27, 0x0a,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x4c,
+  0x4f, 0x41, 0x44, 0x0a, 0x09, 0x63, 0x61, 0x6c, 0x6c, 0x09, 0x23, 0x6c,
+  0x72, 0x75, 0x5f, 0x68, 0x75, 0x62, 0x61, 0x64, 0x64, 0x72, 0x0a, 0x09,
+  0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d,
+  0x70, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09,
+  0x70, 0x63, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a,
+  0x09, 0x61, 0x64, 0x64, 0x09, 0x70, 0x63, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x73, 0x75, 0x62, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x66,
+  0x63, 0x61, 0x64, 0x64, 0x72, 0x0a, 0x09, 0x74, 0x6a, 0x7a, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x52,
+  0x54, 0x09, 0x27, 0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x6c, 0x6f,
+  0x61, 0x64, 0x65, 0x64, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72,
+  0x75, 0x5f, 0x66, 0x63, 0x61, 0x64, 0x64, 0x72, 0x2c, 0x20, 0x6c, 0x72,
+  0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x74, 0x6d, 0x70, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x23, 0x32, 0x0a, 0x09,
+  0x27, 0x27, 0x20, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65,
+  0x73, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x49, 0x4e,
+  0x45, 0x5f, 0x4c, 0x4f, 0x47, 0x32, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x31, 0x0a,
+  0x09, 0x6d, 0x61, 0x78, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70,
+  0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x2a,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x57, 0x41, 0x59, 0x53, 0x0a, 0x09, 0x6d, 0x6f,
+  0x76, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6b, 0x69, 0x6c,
+  0x6c, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x73,
+  0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6b, 0x69, 0x6c, 0x6c, 0x0a,
+  0x09, 0x6d, 0x6f, 0x76, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20, 0x23, 0x31,
+  0x09, 0x09, 0x27, 0x20, 0x6e, 0x6f, 0x20, 0x74, 0x61, 0x67, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x0a,
+  0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6b,
+  0x69, 0x6c, 0x6c, 0x2c, 0x20, 0x69, 0x6e, 0x63, 0x5f, 0x64, 0x65, 0x73,
+  0x74, 0x31, 0x0a, 0x09, 0x64, 0x6a, 0x6e, 0x7a, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x66,
+  0x63, 0x6b, 0x69, 0x6c, 0x6c, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09,
+  0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6c, 0x64, 0x6c, 0x70, 0x2c, 0x20,
+  0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f,
+  0x53, 0x54, 0x41, 0x52, 0x54, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c,
+  0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x52,
+  0x54, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f,
+  0x66, 0x63, 0x6a, 0x6d, 0x70, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74,
+  0x6d, 0x70, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6c, 0x64, 0x6c,
+  0x70, 0x0a, 0x09, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x2d,
+  0x30, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x0a, 0x09,
+  0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x2c,
+  0x20, 0x23, 0x34, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x09, 0x6c, 0x72, 0x75,
+  0x5f, 0x66, 0x63, 0x6c, 0x64, 0x6c, 0x70, 0x2c, 0x20, 0x69, 0x6e, 0x63,
+  0x5f, 0x64, 0x65, 0x73, 0x74, 0x31, 0x0a, 0x09, 0x64, 0x6a, 0x6e, 0x7a,
+  0x09, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20,
+  0x23, 0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6c, 0x64, 0x6c, 0x70, 0x0a,
+  0x6c, 0x72, 0x75, 0x5f, 0x66, 0x63, 0x6a, 0x6d, 0x70, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x09, 0x30, 0x2d, 0x30, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f,
+  0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09,
+  0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f,
+  0x53, 0x54, 0x41, 0x52, 0x54, 0x0a, 0x0a, 0x09, 0x27, 0x27, 0x0a, 0x09,
+  0x27, 0x27, 0x20, 0x5f, 0x5f, 0x73, 0x65, 0x74, 0x6a, 0x6d, 0x70, 0x20,
+  0x75, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x3a, 0x20, 0x69,
+  0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x0a, 0x09, 0x27, 0x27, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x4c, 0x4d, 0x4d, 0x5f,
+  0x53, 0x45, 0x54, 0x4a, 0x4d, 0x50, 0x5f, 0x52, 0x41, 0x20, 0x67, 0x6f,
+  0x65, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x61,
+  0x20, 0x6c, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68,
+  0x75, 0x62, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x67, 0x6f, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x70,
+  0x63, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45,
+  0x54, 0x4a, 0x4d, 0x50, 0x5f, 0x52, 0x41, 0x20, 0x62, 0x65, 0x63, 0x6f,
+  0x6d, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x74,
+  0x6f, 0x0a, 0x09, 0x27, 0x27, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x4f,
+  0x4f, 0x50, 0x3b, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+  0x65, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6c,
+  0x65, 0x66, 0x74, 0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x0a, 0x09, 0x27,
+  0x27, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x4a, 0x4d, 0x50,
+  0x5f, 0x50, 0x43, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x52, 0x41, 0x2c, 0x20, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54,
+  0x4a, 0x4d, 0x50, 0x5f, 0x52, 0x41, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x09,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x2c, 0x20, 0x23, 0x24, 0x31, 0x66,
+  0x66, 0x0a, 0x09, 0x63, 0x6d, 0x70, 0x09, 0x4c, 0x4d, 0x4d, 0x5f, 0x52,
+  0x41, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41, 0x43,
+  0x48, 0x45, 0x5f, 0x53, 0x54, 0x41, 0x52, 0x54, 0x20, 0x77, 0x63, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x5f, 0x6e, 0x63, 0x09, 0x63, 0x6d, 0x70, 0x09,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x2c, 0x20, 0x23, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x45, 0x4e, 0x44, 0x20,
+  0x77, 0x63, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x6e, 0x63, 0x09, 0x6a,
+  0x6d, 0x70, 0x09, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x4a,
+  0x4d, 0x50, 0x5f, 0x50, 0x43, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09, 0x63,
+  0x61, 0x6c, 0x6c, 0x09, 0x23, 0x6c, 0x72, 0x75, 0x5f, 0x68, 0x75, 0x62,
+  0x61, 0x64, 0x64, 0x72, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x09, 0x70, 0x63,
+  0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6d,
+  0x6f, 0x76, 0x09, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x4a, 0x4d,
+  0x50, 0x5f, 0x52, 0x41, 0x2c, 0x20, 0x6c, 0x72, 0x75, 0x5f, 0x72, 0x65,
+  0x73, 0x75, 0x6d, 0x65, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54,
+  0x4a, 0x4d, 0x50, 0x5f, 0x50, 0x43, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x09,
+  0x72, 0x65, 0x74, 0x0a, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x4a, 0x55, 0x4d,
+  0x50, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x4a, 0x55,
+  0x4d, 0x50, 0x5f, 0x50, 0x54, 0x52, 0x5f, 0x72, 0x65, 0x74, 0x0a, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x72, 0x65, 0x74, 0x0a,
+  0x4c, 0x4d, 0x4d, 0x5f, 0x43, 0x41, 0x4c, 0x4c, 0x5f, 0x50, 0x54, 0x52,
+  0x5f, 0x72, 0x65, 0x74, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x45, 0x54,
+  0x5f, 0x72, 0x65, 0x74, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x46, 0x43, 0x41,
+  0x43, 0x48, 0x45, 0x5f, 0x4c, 0x4f, 0x41, 0x44, 0x5f, 0x72, 0x65, 0x74,
+  0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x52, 0x41, 0x0a, 0x09, 0x6c, 0x6f, 0x6e,
+  0x67, 0x09, 0x30, 0x09, 0x27, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x4c, 0x4d, 0x4d, 0x20, 0x73, 0x75, 0x62, 0x72, 0x6f, 0x75, 0x74,
+  0x69, 0x6e, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x73, 0x0a, 0x70, 0x63,
+  0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a, 0x4c, 0x4d, 0x4d,
+  0x5f, 0x4e, 0x45, 0x57, 0x5f, 0x50, 0x43, 0x0a, 0x09, 0x6c, 0x6f, 0x6e,
+  0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x70, 0x63, 0x0a, 0x09,
+  0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x09, 0x27, 0x20, 0x48, 0x55, 0x42,
+  0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6f, 0x20,
+  0x67, 0x6f, 0x20, 0x74, 0x6f, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x53, 0x45,
+  0x54, 0x4a, 0x4d, 0x50, 0x5f, 0x52, 0x41, 0x0a, 0x09, 0x6c, 0x6f, 0x6e,
+  0x67, 0x09, 0x30, 0x0a, 0x68, 0x75, 0x62, 0x72, 0x65, 0x74, 0x70, 0x74,
+  0x72, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x40, 0x40, 0x40, 0x68,
+  0x75, 0x62, 0x5f, 0x72, 0x65, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x63, 0x6f,
+  0x67, 0x0a, 0x69, 0x6e, 0x63, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x31, 0x0a,
+  0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x28, 0x31, 0x3c, 0x3c, 0x39, 0x29,
+  0x0a, 0x69, 0x6e, 0x63, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x32, 0x0a, 0x09,
+  0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x28, 0x32, 0x3c, 0x3c, 0x39, 0x29, 0x0a,
+  0x6c, 0x72, 0x75, 0x5f, 0x77, 0x72, 0x62, 0x69, 0x74, 0x0a, 0x09, 0x6c,
+  0x6f, 0x6e, 0x67, 0x09, 0x28, 0x31, 0x3c, 0x3c, 0x32, 0x33, 0x29, 0x0a,
+  0x6c, 0x72, 0x75, 0x5f, 0x6a, 0x6d, 0x70, 0x6e, 0x65, 0x78, 0x74, 0x0a,
+  0x09, 0x6a, 0x6d, 0x70, 0x09, 0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x4e, 0x45,
+  0x58, 0x54, 0x5f, 0x4c, 0x49, 0x4e, 0x45, 0x0a, 0x6c, 0x72, 0x75, 0x5f,
+  0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x0a, 0x09, 0x6a, 0x6d, 0x70, 0x09,
+  0x23, 0x4c, 0x4d, 0x4d, 0x5f, 0x4c, 0x4f, 0x4f, 0x50, 0x0a, 0x73, 0x61,
+  0x76, 0x65, 0x5f, 0x63, 0x7a, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09,
+  0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x0a, 0x09,
+  0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x09, 0x27, 0x20, 0x48, 0x55, 0x42,
+  0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20,
+  0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6f, 0x67,
+  0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30,
+  0x09, 0x27, 0x20, 0x43, 0x4f, 0x47, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x6c,
+  0x72, 0x75, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x09, 0x6c, 0x6f, 0x6e,
+  0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61, 0x67, 0x0a,
+  0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f,
+  0x74, 0x6d, 0x70, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a,
+  0x6c, 0x72, 0x75, 0x5f, 0x70, 0x74, 0x72, 0x0a, 0x09, 0x6c, 0x6f, 0x6e,
+  0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x72, 0x65, 0x74, 0x0a,
+  0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09,
+  0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x76, 0x69, 0x63, 0x74, 0x69, 0x6d,
+  0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75,
+  0x5f, 0x6f, 0x6c, 0x64, 0x65, 0x73, 0x74, 0x0a, 0x09, 0x6c, 0x6f, 0x6e,
+  0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x63, 0x6c, 0x6f, 0x63,
+  0x6b, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72,
+  0x75, 0x5f, 0x66, 0x63, 0x61, 0x64, 0x64, 0x72, 0x0a, 0x09, 0x6c, 0x6f,
+  0x6e, 0x67, 0x09, 0x30, 0x09, 0x27, 0x20, 0x48, 0x55, 0x42, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x61, 0x74, 0x20, 0x4c, 0x4d,
+  0x4d, 0x5f, 0x46, 0x43, 0x41, 0x43, 0x48, 0x45, 0x5f, 0x53, 0x54, 0x41,
+  0x52, 0x54, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65,
+  0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x0a, 0x09, 0x6c, 0x6f,
+  0x6e, 0x67, 0x09, 0x30, 0x0a, 0x4c, 0x4d, 0x4d, 0x5f, 0x63, 0x61, 0x63,
+  0x68, 0x65, 0x5f, 0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x0a, 0x09, 0x6c,
+  0x6f, 0x6e, 0x67, 0x09, 0x30, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x74, 0x61,
+  0x67, 0x73, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x5b, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x2a, 0x4c, 0x4d, 0x4d, 0x5f,
+  0x57, 0x41, 0x59, 0x53, 0x5d, 0x0a, 0x6c, 0x72, 0x75, 0x5f, 0x61, 0x67,
+  0x65, 0x73, 0x0a, 0x09, 0x6c, 0x6f, 0x6e, 0x67, 0x09, 0x30, 0x5b, 0x4c,
+  0x4d, 0x4d, 0x5f, 0x53, 0x45, 0x54, 0x53, 0x2a, 0x4c, 0x4d, 0x4d, 0x5f,
+  0x57, 0x41, 0x59, 0x53, 0x5d, 0x0a, 0x00
+};
+unsigned int sys_lmm_lru_spin_len = 8166;
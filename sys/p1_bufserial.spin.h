@@ -0,0 +1,317 @@
+unsigned char sys_p1_bufserial_spin[] = {
+  0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x50, 0x31, 0x20, 0x68, 0x65, 0x6c,
+  0x70, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x2d, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x3d, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x65, 0x64, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20,
+  0x54, 0x68, 0x69, 0x73, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x61, 0x20,
+  0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x72, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76,
+  0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x72, 0x6f, 0x75, 0x74,
+  0x69, 0x6e, 0x65, 0x73, 0x2c, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68,
+  0x69, 0x6e, 0x67, 0x0a, 0x27, 0x27, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65,
+  0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x6d, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x6a, 0x6d, 0x70, 0x72, 0x65, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x65, 0x76, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x6d, 0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 0x6f, 0x20,
+  0x77, 0x61, 0x69, 0x74, 0x2c, 0x20, 0x6c, 0x69, 0x6b, 0x65, 0x0a, 0x27,
+  0x27, 0x20, 0x46, 0x75, 0x6c, 0x6c, 0x44, 0x75, 0x70, 0x6c, 0x65, 0x78,
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x2e, 0x20, 0x49, 0x74, 0x20, 0x72,
+  0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74,
+  0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x5f,
+  0x62, 0x69, 0x74, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x73, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x0a, 0x27, 0x27, 0x20, 0x62, 0x79,
+  0x74, 0x65, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x5f, 0x73, 0x65, 0x74, 0x62,
+  0x61, 0x75, 0x64, 0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x73, 0x2e, 0x0a, 0x27, 0x27, 0x0a, 0x0a, 0x27, 0x27, 0x20,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65,
+  0x6c, 0x70, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x67, 0x3b, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x30, 0x20, 0x69, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x66,
+  0x72, 0x65, 0x65, 0x20, 0x63, 0x6f, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x69, 0x74, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x62, 0x75, 0x66, 0x73,
+  0x65, 0x72, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x0a, 0x20, 0x20, 0x5f,
+  0x62, 0x75, 0x66, 0x73, 0x65, 0x72, 0x5f, 0x62, 0x69, 0x74, 0x63, 0x79,
+  0x63, 0x6c, 0x65, 0x73, 0x20, 0x3a, 0x3d, 0x20, 0x40, 0x5f, 0x62, 0x69,
+  0x74, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x5f, 0x62,
+  0x75, 0x66, 0x73, 0x65, 0x72, 0x5f, 0x63, 0x6f, 0x67, 0x20, 0x3a, 0x3d,
+  0x20, 0x63, 0x6f, 0x67, 0x6e, 0x65, 0x77, 0x28, 0x40, 0x5f, 0x62, 0x75,
+  0x66, 0x73, 0x65, 0x72, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2c, 0x20,
+  0x40, 0x5f, 0x62, 0x75, 0x66, 0x73, 0x65, 0x72, 0x5f, 0x74, 0x78, 0x68,
+  0x65, 0x61, 0x64, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x62, 0x75, 0x66, 0x73, 0x65,
+  0x72, 0x5f, 0x63, 0x6f, 0x67, 0x0a, 0x0a, 0x64, 0x61, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x67, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x30, 0x0a, 0x5f, 0x62, 0x75, 0x66, 0x73, 0x65, 0x72,
+  0x5f, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x27, 0x20, 0x70, 0x61, 0x72, 0x20, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x5f, 0x62, 0x75, 0x66, 0x73,
+  0x65, 0x72, 0x5f, 0x74, 0x78, 0x68, 0x65, 0x61, 0x64, 0x3b, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x72,
+  0x69, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74,
+  0x68, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27,
+  0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x6c,
+  0x6c, 0x6f, 0x77, 0x20, 0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x70, 0x61, 0x72, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x34, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74, 0x61, 0x69,
+  0x6c, 0x70, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x34, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x68, 0x65, 0x61,
+  0x64, 0x70, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x34, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x74, 0x61, 0x69,
+  0x6c, 0x70, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x34, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x64, 0x6c, 0x6f,
+  0x6e, 0x67, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x62, 0x69, 0x74, 0x70, 0x2c,
+  0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x34, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73,
+  0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x5f, 0x74, 0x78, 0x62, 0x75, 0x66,
+  0x73, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f,
+  0x72, 0x78, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74,
+  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x64,
+  0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74,
+  0x61, 0x69, 0x6c, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74, 0x61,
+  0x69, 0x6c, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x68, 0x65, 0x61, 0x64, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78,
+  0x68, 0x65, 0x61, 0x64, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6f, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75,
+  0x74, 0x61, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x6d, 0x61, 0x73,
+  0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x72, 0x61, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x78, 0x6d, 0x61, 0x73, 0x6b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x2c,
+  0x20, 0x23, 0x62, 0x73, 0x5f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69,
+  0x74, 0x0a, 0x0a, 0x62, 0x73, 0x5f, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x6d,
+  0x70, 0x72, 0x65, 0x74, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x63,
+  0x6f, 0x64, 0x65, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6f,
+  0x64, 0x65, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x6c, 0x65, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74,
+  0x74, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x75, 0x6e, 0x74, 0x69,
+  0x6c, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x62, 0x69,
+  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65,
+  0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x6d,
+  0x61, 0x73, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x61, 0x20, 0x77, 0x63, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x5f, 0x63, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x62, 0x73, 0x5f, 0x72, 0x65, 0x63, 0x65,
+  0x69, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x62,
+  0x69, 0x74, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x23, 0x39, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x63, 0x6e, 0x74, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x72, 0x78, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x72, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x63, 0x6e, 0x74, 0x2c,
+  0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x61, 0x64, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x63, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6e, 0x74, 0x0a, 0x3a, 0x62,
+  0x69, 0x74, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x63, 0x6e, 0x74, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x72, 0x78, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x0a, 0x3a,
+  0x77, 0x61, 0x69, 0x74, 0x20, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x72, 0x65,
+  0x74, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x63, 0x6f, 0x64, 0x65,
+  0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x62,
+  0x73, 0x5f, 0x72, 0x78, 0x63, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x63, 0x6e, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x73, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x30,
+  0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x6e, 0x63, 0x20,
+  0x6a, 0x6d, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x3a, 0x77, 0x61,
+  0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+  0x65, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78,
+  0x6d, 0x61, 0x73, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x61, 0x20, 0x77, 0x63,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x63, 0x72,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x62, 0x79,
+  0x74, 0x65, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x64, 0x6a, 0x6e, 0x7a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x73, 0x5f, 0x72, 0x78, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x23, 0x3a,
+  0x62, 0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x68, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x62, 0x79, 0x74, 0x65, 0x2c, 0x20, 0x23, 0x33, 0x32, 0x2d, 0x39,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x62, 0x79,
+  0x74, 0x65, 0x2c, 0x20, 0x23, 0x24, 0x66, 0x66, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x70, 0x75, 0x74, 0x20, 0x69,
+  0x74, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x2c, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20,
+  0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6c, 0x6c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x72, 0x78, 0x68, 0x65, 0x61, 0x64, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23,
+  0x5f, 0x72, 0x78, 0x62, 0x75, 0x66, 0x73, 0x69, 0x7a, 0x65, 0x2d, 0x31,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x64, 0x6c,
+  0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x32, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x72, 0x78, 0x74, 0x61, 0x69, 0x6c, 0x70, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x62, 0x73,
+  0x5f, 0x74, 0x32, 0x20, 0x77, 0x7a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f,
+  0x7a, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23,
+  0x62, 0x73, 0x5f, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x32, 0x2c, 0x20, 0x62, 0x73,
+  0x5f, 0x72, 0x78, 0x68, 0x65, 0x61, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x32, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78,
+  0x64, 0x61, 0x74, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x72, 0x62, 0x79, 0x74, 0x65, 0x20, 0x20, 0x62, 0x73, 0x5f,
+  0x72, 0x78, 0x62, 0x79, 0x74, 0x65, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74,
+  0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f,
+  0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x68,
+  0x65, 0x61, 0x64, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x72, 0x6c, 0x6f, 0x6e,
+  0x67, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x68, 0x65, 0x61, 0x64,
+  0x2c, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x68, 0x65, 0x61, 0x64, 0x70,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x6d, 0x70,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x62, 0x73, 0x5f, 0x72, 0x65, 0x63,
+  0x65, 0x69, 0x76, 0x65, 0x0a, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x72, 0x61,
+  0x6e, 0x73, 0x6d, 0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6a, 0x6d, 0x70, 0x72, 0x65, 0x74, 0x20, 0x20, 0x62, 0x73,
+  0x5f, 0x74, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x2c, 0x20, 0x62, 0x73, 0x5f,
+  0x72, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20,
+  0x6c, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65,
+  0x69, 0x76, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x75, 0x6e, 0x74,
+  0x69, 0x6c, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20,
+  0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x70, 0x61, 0x72, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x62, 0x73, 0x5f,
+  0x74, 0x78, 0x74, 0x61, 0x69, 0x6c, 0x20, 0x77, 0x7a, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x23, 0x62, 0x73, 0x5f, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d,
+  0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
+  0x6f, 0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31,
+  0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74, 0x61, 0x69, 0x6c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x78, 0x64, 0x61, 0x74, 0x61, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x64, 0x62, 0x79, 0x74, 0x65, 0x20,
+  0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x62, 0x79, 0x74, 0x65, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73,
+  0x5f, 0x74, 0x78, 0x74, 0x61, 0x69, 0x6c, 0x2c, 0x20, 0x23, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74, 0x61, 0x69,
+  0x6c, 0x2c, 0x20, 0x23, 0x5f, 0x74, 0x78, 0x62, 0x75, 0x66, 0x73, 0x69,
+  0x7a, 0x65, 0x2d, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x72, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62, 0x73, 0x5f,
+  0x74, 0x78, 0x74, 0x61, 0x69, 0x6c, 0x2c, 0x20, 0x62, 0x73, 0x5f, 0x74,
+  0x78, 0x74, 0x61, 0x69, 0x6c, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x78, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x62,
+  0x73, 0x5f, 0x62, 0x69, 0x74, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6f, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x78, 0x62, 0x79, 0x74, 0x65, 0x2c, 0x20, 0x23, 0x24,
+  0x31, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27,
+  0x20, 0x73, 0x74, 0x6f, 0x70, 0x20, 0x62, 0x69, 0x74, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6c, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x62, 0x79, 0x74, 0x65, 0x2c,
+  0x20, 0x23, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6f, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74,
+  0x78, 0x62, 0x79, 0x74, 0x65, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x69, 0x64,
+  0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x2c, 0x20, 0x74, 0x68, 0x65,
+  0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+  0x62, 0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x6f, 0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74,
+  0x78, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x23, 0x31, 0x31, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6e, 0x74, 0x2c,
+  0x20, 0x63, 0x6e, 0x74, 0x0a, 0x3a, 0x62, 0x69, 0x74, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x68, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f,
+  0x74, 0x78, 0x62, 0x79, 0x74, 0x65, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77,
+  0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x75,
+  0x78, 0x63, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75, 0x74, 0x61, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x78, 0x6d, 0x61, 0x73, 0x6b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6e, 0x74, 0x2c, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x78, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x0a, 0x3a,
+  0x77, 0x61, 0x69, 0x74, 0x20, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x72, 0x65,
+  0x74, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6f, 0x64, 0x65,
+  0x2c, 0x20, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x62,
+  0x73, 0x5f, 0x74, 0x78, 0x63, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x63, 0x6e, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x73, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x31, 0x2c, 0x20, 0x23, 0x30,
+  0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x6e, 0x63, 0x20,
+  0x6a, 0x6d, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x3a, 0x77, 0x61,
+  0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+  0x6a, 0x6e, 0x7a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x5f, 0x74, 0x78,
+  0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x23, 0x3a, 0x62, 0x69, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x23, 0x62, 0x73, 0x5f, 0x74, 0x72, 0x61, 0x6e,
+  0x73, 0x6d, 0x69, 0x74, 0x0a, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x6d,
+  0x61, 0x73, 0x6b, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x20, 0x3c, 0x3c, 0x20, 0x5f, 0x74, 0x78, 0x70, 0x69,
+  0x6e, 0x0a, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x6d, 0x61, 0x73, 0x6b, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x20, 0x20, 0x31, 0x20,
+  0x3c, 0x3c, 0x20, 0x5f, 0x72, 0x78, 0x70, 0x69, 0x6e, 0x0a, 0x62, 0x73,
+  0x5f, 0x74, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74,
+  0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74,
+  0x61, 0x69, 0x6c, 0x70, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x68, 0x65, 0x61,
+  0x64, 0x70, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x31, 0x0a, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x74, 0x61, 0x69, 0x6c, 0x70,
+  0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a,
+  0x62, 0x73, 0x5f, 0x62, 0x69, 0x74, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73,
+  0x5f, 0x74, 0x78, 0x64, 0x61, 0x74, 0x61, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x64, 0x61, 0x74, 0x61, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74,
+  0x61, 0x69, 0x6c, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x68, 0x65, 0x61,
+  0x64, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a,
+  0x62, 0x73, 0x5f, 0x72, 0x78, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73,
+  0x5f, 0x74, 0x78, 0x62, 0x79, 0x74, 0x65, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74,
+  0x78, 0x62, 0x69, 0x74, 0x73, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x63,
+  0x6e, 0x74, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x74, 0x78, 0x74, 0x69, 0x63,
+  0x6b, 0x73, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x31, 0x0a, 0x62, 0x73, 0x5f, 0x72, 0x78, 0x62, 0x79, 0x74, 0x65, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a,
+  0x62, 0x73, 0x5f, 0x72, 0x78, 0x62, 0x69, 0x74, 0x73, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73,
+  0x5f, 0x72, 0x78, 0x63, 0x6e, 0x74, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x62, 0x73, 0x5f, 0x72,
+  0x78, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x20, 0x20, 0x72, 0x65, 0x73, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x00
+};
+unsigned int sys_p1_bufserial_spin_len = 3762;
@@ -0,0 +1,134 @@
+unsigned char sys_profile_spin[] = {
+  0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72,
+  0x74, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x2d,
+  0x66, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x67, 0x65, 0x6e,
+  0x65, 0x72, 0x61, 0x74, 0x65, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20,
+  0x54, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6e, 0x65,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20,
+  0x5f, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x65, 0x6e, 0x74, 0x72,
+  0x79, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x27, 0x27, 0x20, 0x74, 0x77,
+  0x6f, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6c,
+  0x6f, 0x6f, 0x70, 0x20, 0x28, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73,
+  0x2c, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x29, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x66, 0x20, 0x73, 0x74, 0x61,
+  0x74, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x28, 0x74, 0x68, 0x65, 0x6e,
+  0x2c, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x29, 0x2e, 0x0a, 0x27, 0x27, 0x20,
+  0x54, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72,
+  0x20, 0x73, 0x65, 0x74, 0x73, 0x20, 0x5f, 0x5f, 0x72, 0x65, 0x61, 0x6c,
+  0x5f, 0x70, 0x72, 0x6f, 0x66, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f, 0x20,
+  0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+  0x72, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x27, 0x27, 0x20, 0x66, 0x69, 0x6c,
+  0x6c, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f,
+  0x64, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f,
+  0x73, 0x69, 0x74, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x6c, 0x69, 0x6e,
+  0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73,
+  0x69, 0x74, 0x65, 0x2e, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x5f,
+  0x6c, 0x6d, 0x6d, 0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x73, 0x74,
+  0x61, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x62, 0x79, 0x20, 0x2d,
+  0x2d, 0x6c, 0x6d, 0x6d, 0x3d, 0x6c, 0x72, 0x75, 0x2c, 0x73, 0x74, 0x61,
+  0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20,
+  0x74, 0x68, 0x65, 0x0a, 0x27, 0x27, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65,
+  0x6c, 0x27, 0x73, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2e, 0x0a, 0x27, 0x27, 0x0a, 0x63,
+  0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f,
+  0x70, 0x72, 0x6f, 0x66, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f, 0x20, 0x3d,
+  0x20, 0x31, 0x20, 0x27, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x6f, 0x66, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c,
+  0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x0a, 0x0a, 0x64, 0x61,
+  0x74, 0x0a, 0x5f, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+  0x20, 0x30, 0x5b, 0x5f, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x70, 0x72,
+  0x6f, 0x66, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x5f, 0x5d, 0x0a, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x69, 0x6e, 0x63,
+  0x28, 0x69, 0x29, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x40,
+  0x5f, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x73, 0x5d, 0x5b, 0x69, 0x5d, 0x2b, 0x2b, 0x0a, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73, 0x74, 0x72, 0x28, 0x73,
+  0x29, 0x20, 0x7c, 0x20, 0x63, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
+  0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x63, 0x20,
+  0x3a, 0x3d, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x2b, 0x2b, 0x5d,
+  0x29, 0x20, 0x3c, 0x3e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f,
+  0x74, 0x78, 0x28, 0x63, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
+  0x70, 0x72, 0x6f, 0x66, 0x5f, 0x64, 0x65, 0x63, 0x28, 0x78, 0x29, 0x20,
+  0x7c, 0x20, 0x64, 0x2c, 0x20, 0x71, 0x2c, 0x20, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x64, 0x20, 0x3a, 0x3d, 0x20, 0x31,
+  0x5f, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30,
+  0x0a, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x3a,
+  0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+  0x20, 0x31, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x71, 0x20, 0x3a, 0x3d,
+  0x20, 0x78, 0x20, 0x2b, 0x2f, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x71, 0x20, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x65, 0x64, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x20, 0x3d, 0x3d, 0x20,
+  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x74, 0x78, 0x28,
+  0x22, 0x30, 0x22, 0x20, 0x2b, 0x20, 0x71, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x3a,
+  0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3a, 0x3d,
+  0x20, 0x78, 0x20, 0x2b, 0x2f, 0x2f, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x64, 0x20, 0x3a, 0x3d, 0x20, 0x64, 0x20, 0x2f, 0x20, 0x31, 0x30,
+  0x0a, 0x0a, 0x27, 0x27, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x61,
+  0x20, 0x73, 0x69, 0x74, 0x65, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77,
+  0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6e, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x73, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66,
+  0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x28, 0x73, 0x2c, 0x20, 0x69, 0x2c, 0x20,
+  0x6e, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73,
+  0x74, 0x72, 0x28, 0x73, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
+  0x61, 0x74, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x74, 0x78,
+  0x28, 0x22, 0x20, 0x22, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x70,
+  0x72, 0x6f, 0x66, 0x5f, 0x64, 0x65, 0x63, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+  0x5b, 0x40, 0x5f, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x73, 0x5d, 0x5b, 0x69, 0x2b, 0x2b, 0x5d, 0x29, 0x0a, 0x20,
+  0x20, 0x5f, 0x74, 0x78, 0x28, 0x31, 0x30, 0x29, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73, 0x69, 0x74, 0x65,
+  0x73, 0x0a, 0x20, 0x20, 0x27, 0x27, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65,
+  0x64, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x64, 0x75, 0x6d, 0x70,
+  0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73, 0x74, 0x72,
+  0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22, 0x23, 0x70, 0x72,
+  0x6f, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x31, 0x22, 0x2c, 0x20, 0x31, 0x30,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73,
+  0x69, 0x74, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66,
+  0x5f, 0x73, 0x74, 0x72, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28,
+  0x22, 0x23, 0x65, 0x6e, 0x64, 0x22, 0x2c, 0x20, 0x31, 0x30, 0x29, 0x29,
+  0x0a, 0x0a, 0x27, 0x27, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x2d, 0x2d, 0x6c, 0x6d, 0x6d, 0x3d, 0x6c, 0x72, 0x75,
+  0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x6c, 0x6d, 0x6d,
+  0x5f, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73,
+  0x28, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x2c, 0x20, 0x6d, 0x69,
+  0x73, 0x73, 0x65, 0x73, 0x29, 0x20, 0x7c, 0x20, 0x68, 0x69, 0x74, 0x73,
+  0x0a, 0x20, 0x20, 0x68, 0x69, 0x74, 0x73, 0x20, 0x3a, 0x3d, 0x20, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x20, 0x2d, 0x20, 0x6d, 0x69, 0x73,
+  0x73, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f,
+  0x73, 0x74, 0x72, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22,
+  0x23, 0x6c, 0x6d, 0x6d, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3a, 0x20,
+  0x22, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f,
+  0x64, 0x65, 0x63, 0x28, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x29,
+  0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73, 0x74, 0x72,
+  0x28, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22, 0x20, 0x6c, 0x6f,
+  0x6f, 0x6b, 0x75, 0x70, 0x73, 0x2c, 0x20, 0x22, 0x29, 0x29, 0x0a, 0x20,
+  0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x64, 0x65, 0x63, 0x28, 0x6d,
+  0x69, 0x73, 0x73, 0x65, 0x73, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x70, 0x72,
+  0x6f, 0x66, 0x5f, 0x73, 0x74, 0x72, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6e,
+  0x67, 0x28, 0x22, 0x20, 0x6d, 0x69, 0x73, 0x73, 0x65, 0x73, 0x22, 0x29,
+  0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
+  0x70, 0x73, 0x20, 0x2b, 0x3e, 0x20, 0x31, 0x30, 0x30, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f, 0x73, 0x74, 0x72, 0x28,
+  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x22, 0x20, 0x28, 0x22, 0x29,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x70, 0x72, 0x6f, 0x66, 0x5f,
+  0x64, 0x65, 0x63, 0x28, 0x68, 0x69, 0x74, 0x73, 0x20, 0x2b, 0x2f, 0x20,
+  0x28, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x73, 0x20, 0x2b, 0x2f, 0x20,
+  0x31, 0x30, 0x30, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x70,
+  0x72, 0x6f, 0x66, 0x5f, 0x73, 0x74, 0x72, 0x28, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x28, 0x22, 0x25, 0x20, 0x68, 0x69, 0x74, 0x73, 0x29, 0x22,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x74, 0x78, 0x28, 0x31, 0x30, 0x29,
+  0x0a, 0x00
+};
+unsigned int sys_profile_spin_len = 1561;